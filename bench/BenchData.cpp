@@ -0,0 +1,72 @@
+// bench/BenchData.cpp
+#include "BenchData.hpp"
+#include "Blas.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace bench {
+
+Matrix spdMatrix(std::size_t n, unsigned seed) {
+    const Matrix B = randomMatrix(n, n, seed);
+    Matrix A(n, n);
+    gemm(Transpose::Yes, Transpose::No, 1.0 / double(n), B, B, 0.0, A);
+    for (std::size_t i = 0; i < n; ++i)
+        A.row(i)[i] += 1.0;
+    return A;
+}
+
+std::string machineCsv(std::size_t rows, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> myct(17, 1500), mmin(64, 32000), mmax(64, 64000),
+                                       cach(0, 256), chmin(0, 52), chmax(0, 176);
+    std::normal_distribution<double> noise(0.0, 40.0);
+    std::ostringstream out;
+    for (std::size_t i = 0; i < rows; ++i) {
+        const int f[6] = { myct(rng), mmin(rng), mmax(rng), cach(rng), chmin(rng), chmax(rng) };
+        const double prp = -55.0 + 0.05 * f[0] + 0.016 * f[1] + 0.005 * f[2]
+                         + 0.6 * f[3] - 0.3 * f[4] + 1.5 * f[5] + noise(rng);
+        out << "vendor,model" << i;
+        for (int v : f) out << ',' << v;
+        out << ',' << int(prp) << ',' << int(prp) << '\n';
+    }
+    return out.str();
+}
+
+std::string scaledMachineFile(std::size_t scale) {
+    // Numeric fields of the source rows; the first two columns are names.
+    std::vector<std::vector<double>> rows;
+    std::ifstream in("data/machine.data");
+    for (std::string line; std::getline(in, line);) {
+        std::istringstream fields(line);
+        std::string field;
+        std::vector<double> values;
+        for (int c = 0; std::getline(fields, field, ','); ++c)
+            if (c >= 2) values.push_back(std::stod(field));
+        if (values.size() == 8) rows.push_back(values);
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path()
+        / ("linalg_bench_machine_x" + std::to_string(scale) + ".data");
+    std::ofstream out(path);
+    if (rows.empty()) {
+        out << machineCsv(209 * scale);
+    } else {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> jitter(0.95, 1.05);
+        for (std::size_t s = 0; s < scale; ++s) {
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                out << "vendor,model" << r;
+                for (double v : rows[r]) out << ',' << long(v * jitter(rng));
+                out << '\n';
+            }
+        }
+    }
+    if (!out)
+        throw std::runtime_error("Cannot write " + path.string());
+    return path.string();
+}
+
+} // namespace bench
@@ -0,0 +1,55 @@
+// bench/BenchData.hpp
+#ifndef BENCHDATA_HPP
+#define BENCHDATA_HPP
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/** Deterministic inputs shared by the benchmark files. */
+namespace bench {
+
+/** rows×cols matrix with entries uniform in [-1, 1]. */
+inline Matrix randomMatrix(std::size_t rows, std::size_t cols, unsigned seed = 1) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix A(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            A.row(i)[j] = dist(rng);
+    return A;
+}
+
+/** Vector with entries uniform in [-1, 1]. */
+inline Vector randomVector(std::size_t n, unsigned seed = 2) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Vector v(n);
+    for (std::size_t i = 0; i < n; ++i)
+        v[i] = dist(rng);
+    return v;
+}
+
+/** Well-conditioned symmetric positive-definite n×n matrix (BᵀB/n + I). */
+Matrix spdMatrix(std::size_t n, unsigned seed = 3);
+
+/**
+ * machine.data-style CSV text (vendor, model, six integer features, PRP,
+ * ERP) with @p rows rows. Features are drawn around the real data's ranges
+ * and PRP follows a fixed linear model plus noise.
+ */
+std::string machineCsv(std::size_t rows, unsigned seed = 4);
+
+/**
+ * data/machine.data (relative to the working directory) replicated
+ * @p scale times with ±5% jitter on every numeric field, written to a
+ * temporary file whose path is returned. Falls back to machineCsv() rows
+ * when the dataset is not found.
+ */
+std::string scaledMachineFile(std::size_t scale);
+
+} // namespace bench
+
+#endif // BENCHDATA_HPP
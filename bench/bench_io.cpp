@@ -0,0 +1,51 @@
+// bench/bench_io.cpp
+// CSV loading: in-memory parsing and the mmap-backed file reader.
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include "BenchData.hpp"
+#include "Dataset.hpp"
+
+namespace {
+
+CsvSchema machineSchema() {
+    CsvSchema schema;
+    schema.columns = { ColumnRole::Ignore, ColumnRole::Ignore,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Target, ColumnRole::Ignore };
+    schema.intercept = true;
+    return schema;
+}
+
+void BM_ParseCsv(benchmark::State& state) {
+    const std::size_t rows = std::size_t(state.range(0));
+    const std::string text = bench::machineCsv(rows);
+    const CsvSchema schema = machineSchema();
+    for (auto _ : state) {
+        Dataset data = parseCsv(text, schema);
+        benchmark::DoNotOptimize(data.X.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(rows));
+}
+BENCHMARK(BM_ParseCsv)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+void BM_ReadCsv(benchmark::State& state) {
+    const std::size_t rows = std::size_t(state.range(0));
+    const std::filesystem::path path = std::filesystem::temp_directory_path()
+        / ("linalg_bench_read_" + std::to_string(rows) + ".csv");
+    const std::string text = bench::machineCsv(rows);
+    std::ofstream(path) << text;
+    const CsvSchema schema = machineSchema();
+    for (auto _ : state) {
+        Dataset data = readCsv(path.string(), schema);
+        benchmark::DoNotOptimize(data.X.data());
+    }
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(rows));
+}
+BENCHMARK(BM_ReadCsv)->RangeMultiplier(8)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+} // namespace
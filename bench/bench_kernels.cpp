@@ -0,0 +1,145 @@
+// bench/bench_kernels.cpp
+// Dense kernels: FLOPS is reported as a rate (FLOP/s), bytes/s counts the
+// operands each call reads and writes once.
+#include <benchmark/benchmark.h>
+#include "BenchData.hpp"
+#include "Blas.hpp"
+
+namespace {
+
+void setFlops(benchmark::State& state, double flopsPerCall) {
+    state.counters["FLOPS"] = benchmark::Counter(flopsPerCall,
+        benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+}
+
+void BM_MatrixMultiply(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n, 1), B = bench::randomMatrix(n, n, 2);
+    for (auto _ : state) {
+        Matrix C = A * B;
+        benchmark::DoNotOptimize(C.data());
+    }
+    setFlops(state, 2.0 * double(n) * double(n) * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(3 * n * n * sizeof(double)));
+}
+BENCHMARK(BM_MatrixMultiply)->RangeMultiplier(2)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+void BM_Gemm(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n, 1), B = bench::randomMatrix(n, n, 2);
+    Matrix C(n, n);
+    for (auto _ : state) {
+        gemm(1.0, A, B, 0.0, C);
+        benchmark::DoNotOptimize(C.data());
+    }
+    setFlops(state, 2.0 * double(n) * double(n) * double(n));
+    state.SetLabel(gemmKernelName());
+}
+BENCHMARK(BM_Gemm)->RangeMultiplier(2)->Range(16, 1024)->Unit(benchmark::kMicrosecond);
+
+void BM_MatrixAdd(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n, 1), B = bench::randomMatrix(n, n, 2);
+    for (auto _ : state) {
+        Matrix C = A + B;
+        benchmark::DoNotOptimize(C.data());
+    }
+    setFlops(state, double(n) * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(3 * n * n * sizeof(double)));
+}
+BENCHMARK(BM_MatrixAdd)->RangeMultiplier(4)->Range(16, 2048);
+
+void BM_MatrixVector(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n);
+    const Vector x = bench::randomVector(n);
+    for (auto _ : state) {
+        Vector y = A * x;
+        benchmark::DoNotOptimize(y.data());
+    }
+    setFlops(state, 2.0 * double(n) * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t((n * n + 2 * n) * sizeof(double)));
+}
+BENCHMARK(BM_MatrixVector)->RangeMultiplier(4)->Range(16, 4096);
+
+void BM_VectorAdd(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Vector a = bench::randomVector(n, 1), b = bench::randomVector(n, 2);
+    for (auto _ : state) {
+        Vector c = a + b;
+        benchmark::DoNotOptimize(c.data());
+    }
+    setFlops(state, double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(3 * n * sizeof(double)));
+}
+BENCHMARK(BM_VectorAdd)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+void BM_VectorScale(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Vector a = bench::randomVector(n);
+    for (auto _ : state) {
+        Vector c = a * 1.5;
+        benchmark::DoNotOptimize(c.data());
+    }
+    setFlops(state, double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(2 * n * sizeof(double)));
+}
+BENCHMARK(BM_VectorScale)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+// y = x + p·α as one fused expression versus the two materialized
+// temporaries (p·α, then x + ·) the eager operators used to produce.
+void BM_VectorFusedUpdate(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Vector x = bench::randomVector(n, 1), p = bench::randomVector(n, 2);
+    Vector y(n);
+    for (auto _ : state) {
+        y = x + p * 0.5;
+        benchmark::DoNotOptimize(y.data());
+    }
+    setFlops(state, 2.0 * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(3 * n * sizeof(double)));
+}
+BENCHMARK(BM_VectorFusedUpdate)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+void BM_VectorTemporaries(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Vector x = bench::randomVector(n, 1), p = bench::randomVector(n, 2);
+    Vector y(n);
+    for (auto _ : state) {
+        Vector scaled = p * 0.5;
+        Vector sum = x + scaled;
+        y = std::move(sum);
+        benchmark::DoNotOptimize(y.data());
+    }
+    setFlops(state, 2.0 * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(3 * n * sizeof(double)));
+}
+BENCHMARK(BM_VectorTemporaries)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+void BM_VectorDot(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Vector a = bench::randomVector(n, 1), b = bench::randomVector(n, 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(a.dot(b));
+    setFlops(state, 2.0 * double(n));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(2 * n * sizeof(double)));
+}
+BENCHMARK(BM_VectorDot)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+// Normal equations of a tall rows×7 design, the regression workload's shape.
+void BM_Gram(benchmark::State& state) {
+    const std::size_t m = std::size_t(state.range(0)), n = 7;
+    const Matrix X = bench::randomMatrix(m, n);
+    const Vector y = bench::randomVector(m);
+    Matrix G(n, n);
+    Vector g(n);
+    for (auto _ : state) {
+        gram(X, y, G, g);
+        benchmark::DoNotOptimize(G.data());
+    }
+    setFlops(state, double(m) * double(n) * double(n + 3));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(m * (n + 1) * sizeof(double)));
+}
+BENCHMARK(BM_Gram)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+} // namespace
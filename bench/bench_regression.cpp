@@ -0,0 +1,117 @@
+// bench/bench_regression.cpp
+// End-to-end RegressionDemo pipeline (load CSV, shuffle 80/20, fused
+// normal equations, Cholesky, test RMSE) on machine.data scaled up by
+// replicating its rows with jitter.
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include "BenchData.hpp"
+#include "Blas.hpp"
+#include "Dataset.hpp"
+#include "LinearModel.hpp"
+#include "LinearSystem.hpp"
+
+namespace {
+
+CsvSchema machineSchema() {
+    CsvSchema schema;
+    schema.columns = { ColumnRole::Ignore, ColumnRole::Ignore,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Target, ColumnRole::Ignore };
+    schema.intercept = true;
+    return schema;
+}
+
+double fitAndScore(const std::string& path, const CsvSchema& schema) {
+    const Dataset data = readCsv(path, schema);
+    const std::size_t n = data.y.size(), p = data.X.cols();
+    const std::size_t trainN = std::size_t(0.8 * double(n)), testN = n - trainN;
+
+    std::vector<std::size_t> idx(n);
+    std::iota(idx.begin(), idx.end(), std::size_t(0));
+    std::mt19937 rng(42);
+    std::shuffle(idx.begin(), idx.end(), rng);
+
+    Matrix Xtrain(trainN, p);
+    Vector ytrain(trainN);
+    for (std::size_t i = 0; i < trainN; ++i) {
+        std::copy(data.X.row(idx[i]), data.X.row(idx[i]) + p, Xtrain.row(i));
+        ytrain[i] = data.y[idx[i]];
+    }
+    Matrix A(p, p);
+    Vector b(p);
+    gram(Xtrain, ytrain, A, b);
+    const Vector beta = CholeskySystem(A, b).Solve();
+
+    double rss = 0.0;
+    for (std::size_t i = trainN; i < n; ++i) {
+        const double* xi = data.X.row(idx[i]);
+        double err = -data.y[idx[i]];
+        for (std::size_t j = 0; j < p; ++j)
+            err += xi[j] * beta[j];
+        rss += err * err;
+    }
+    return std::sqrt(rss / double(testN));
+}
+
+void BM_RegressionEndToEnd(benchmark::State& state) {
+    const std::size_t scale = std::size_t(state.range(0));
+    const std::string path = bench::scaledMachineFile(scale);
+    const std::uintmax_t bytes = std::filesystem::file_size(path);
+    const CsvSchema schema = machineSchema();
+    double rmse = 0.0;
+    for (auto _ : state) {
+        rmse = fitAndScore(path, schema);
+        benchmark::DoNotOptimize(rmse);
+    }
+    std::filesystem::remove(path);
+    state.counters["test_rmse"] = rmse;
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(bytes));
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(209 * scale));
+}
+BENCHMARK(BM_RegressionEndToEnd)->RangeMultiplier(10)->Range(1, 1000)->Unit(benchmark::kMillisecond);
+
+// Serving path: one request, one row of the demo's seven features.
+void BM_LinearModelPredictRow(benchmark::State& state) {
+    const LinearModel model(bench::randomVector(7));
+    const Vector x = bench::randomVector(7, 3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x.data());
+        double y = model.predict(x.data());
+        benchmark::DoNotOptimize(y);
+    }
+}
+BENCHMARK(BM_LinearModelPredictRow);
+
+void BM_LinearModelPredictBatch(benchmark::State& state) {
+    const std::size_t m = std::size_t(state.range(0)), p = 7;
+    const Matrix X = bench::randomMatrix(m, p);
+    const LinearModel model(bench::randomVector(p));
+    Vector out(m);
+    for (auto _ : state) {
+        model.predict(X, Span<double>(out.data(), out.size()));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(m));
+}
+BENCHMARK(BM_LinearModelPredictBatch)->RangeMultiplier(16)->Range(256, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+// Predictions plus RMSE / MAE / R² in one pass, never storing ŷ.
+void BM_LinearModelEvaluate(benchmark::State& state) {
+    const std::size_t m = std::size_t(state.range(0)), p = 7;
+    const Matrix X = bench::randomMatrix(m, p);
+    const Vector y = bench::randomVector(m);
+    const LinearModel model(bench::randomVector(p));
+    for (auto _ : state) {
+        RegressionMetrics metrics = model.evaluate(X, y);
+        benchmark::DoNotOptimize(metrics);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(m));
+}
+BENCHMARK(BM_LinearModelEvaluate)->RangeMultiplier(16)->Range(256, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,106 @@
+// bench/bench_solvers.cpp
+// Dense solvers; every iteration pays the full setup a caller would (the
+// system copies A and b), which is what these APIs cost in practice.
+#include <benchmark/benchmark.h>
+#include "BenchData.hpp"
+#include "FixedMatrix.hpp"
+#include "LinearSystem.hpp"
+#include "MemoryResource.hpp"
+
+namespace {
+
+void setFlops(benchmark::State& state, double flopsPerCall) {
+    state.counters["FLOPS"] = benchmark::Counter(flopsPerCall,
+        benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+}
+
+void BM_LinearSystemSolve(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n);
+    const Vector b = bench::randomVector(n);
+    for (auto _ : state) {
+        Vector x = LinearSystem(A, b).Solve();
+        benchmark::DoNotOptimize(x.data());
+    }
+    setFlops(state, 2.0 / 3.0 * double(n) * double(n) * double(n));
+}
+BENCHMARK(BM_LinearSystemSolve)->RangeMultiplier(2)->Range(8, 2048)->Unit(benchmark::kMicrosecond);
+
+// Float32 LU plus double refinement (compare LinearSystemSolve); the counter
+// reports how many refinement steps each solve needed.
+void BM_MixedPrecisionSolve(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::randomMatrix(n, n);
+    const Vector b = bench::randomVector(n);
+    RefinementResult last;
+    for (auto _ : state) {
+        Vector x(n);
+        last = MixedPrecisionSystem(A, b).Solve(x);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["iterations"] = double(last.iterations);
+    state.counters["fellBack"]   = last.fellBack ? 1.0 : 0.0;
+    setFlops(state, 2.0 / 3.0 * double(n) * double(n) * double(n));
+}
+BENCHMARK(BM_MixedPrecisionSolve)->RangeMultiplier(2)->Range(64, 2048)->Unit(benchmark::kMicrosecond);
+
+void BM_CholeskySystemSolve(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::spdMatrix(n);
+    const Vector b = bench::randomVector(n);
+    for (auto _ : state) {
+        Vector x = CholeskySystem(A, b).Solve();
+        benchmark::DoNotOptimize(x.data());
+    }
+    setFlops(state, 1.0 / 3.0 * double(n) * double(n) * double(n));
+}
+BENCHMARK(BM_CholeskySystemSolve)->Arg(7)->RangeMultiplier(2)->Range(8, 512)->Unit(benchmark::kMicrosecond);
+
+// Same solve with every temporary drawn from a reused per-thread arena
+// (compare CholeskySystemSolve at small n, where allocation matters).
+void BM_CholeskySystemSolveArena(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::spdMatrix(n);
+    const Vector b = bench::randomVector(n);
+    ArenaResource arena;
+    for (auto _ : state) {
+        ScopedArena scope(arena);
+        Vector x = CholeskySystem(A, b).Solve();
+        benchmark::DoNotOptimize(x.data());
+    }
+    setFlops(state, 1.0 / 3.0 * double(n) * double(n) * double(n));
+}
+BENCHMARK(BM_CholeskySystemSolveArena)->Arg(7)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// Stack-allocated, compile-time-sized Cholesky (compare CholeskySystemSolve/7).
+template <std::size_t N>
+void BM_FixedCholeskySolve(benchmark::State& state) {
+    const FixedMatrix<N, N> A(bench::spdMatrix(N));
+    const FixedVector<N> b(bench::randomVector(N));
+    for (auto _ : state) {
+        FixedVector<N> x = FixedCholeskyFactorization<N>(A).solve(b);
+        benchmark::DoNotOptimize(x.data());
+    }
+    setFlops(state, 1.0 / 3.0 * double(N) * double(N) * double(N));
+}
+BENCHMARK_TEMPLATE(BM_FixedCholeskySolve, 7);
+BENCHMARK_TEMPLATE(BM_FixedCholeskySolve, 16);
+
+// Conjugate gradient on a well-conditioned SPD matrix; FLOPS counts the
+// matrix-vector products (2n² per iteration) actually performed.
+void BM_PosSymLinSystemSolve(benchmark::State& state) {
+    const std::size_t n = std::size_t(state.range(0));
+    const Matrix A = bench::spdMatrix(n);
+    const Vector b = bench::randomVector(n);
+    CGResult last;
+    for (auto _ : state) {
+        Vector x(n);
+        last = PosSymLinSystem(A, b, CGOptions()).Solve(x);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["iterations"] = double(last.iterations);
+    setFlops(state, 2.0 * double(n) * double(n) * double(last.iterations));
+}
+BENCHMARK(BM_PosSymLinSystemSolve)->RangeMultiplier(2)->Range(8, 512)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,195 @@
+// include/BasicMatrix.hpp
+#ifndef BASICMATRIX_HPP
+#define BASICMATRIX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Matrix.hpp"
+#include "MemoryResource.hpp"
+#include "Vector.hpp"
+
+namespace detail {
+
+/** Zeroed array of T from the thread's currentResource(), cache-line aligned. */
+template <typename T>
+class AlignedArray {
+public:
+    explicit AlignedArray(std::size_t size)
+        : mSize(size), mResource(currentResource()), mData(allocate(mResource, size))
+    {
+        std::fill(mData, mData + mSize, T(0));
+    }
+    AlignedArray(const AlignedArray& other)
+        : mSize(other.mSize), mResource(currentResource()), mData(allocate(mResource, mSize))
+    {
+        std::copy(other.mData, other.mData + mSize, mData);
+    }
+    AlignedArray(AlignedArray&& other) noexcept
+        : mSize(std::exchange(other.mSize, 0)), mResource(other.mResource),
+          mData(std::exchange(other.mData, nullptr)) {}
+    // Assignment keeps this array's resource, like Matrix and Vector.
+    AlignedArray& operator=(const AlignedArray& other) {
+        if (this != &other) {
+            if (mSize != other.mSize) {
+                T* data = allocate(mResource, other.mSize);
+                release();
+                mSize = other.mSize;
+                mData = data;
+            }
+            std::copy(other.mData, other.mData + mSize, mData);
+        }
+        return *this;
+    }
+    AlignedArray& operator=(AlignedArray&& other) {
+        if (mResource != other.mResource)
+            return *this = other;
+        if (this != &other) {
+            release();
+            mSize = std::exchange(other.mSize, 0);
+            mData = std::exchange(other.mData, nullptr);
+        }
+        return *this;
+    }
+    ~AlignedArray() { release(); }
+
+    std::size_t size() const noexcept { return mSize; }
+    T*       data() noexcept       { return mData; }
+    const T* data() const noexcept { return mData; }
+
+private:
+    static T* allocate(MemoryResource* resource, std::size_t size) {
+        return static_cast<T*>(resource->allocate(size * sizeof(T)));
+    }
+    void release() noexcept {
+        if (mData)
+            mResource->deallocate(mData, mSize * sizeof(T));
+    }
+
+    std::size_t     mSize;
+    MemoryResource* mResource;
+    T*              mData;
+};
+
+} // namespace detail
+
+/**
+ * @brief Dynamic vector over scalar type T (float, double or long double).
+ *
+ * Storage-only counterpart of Vector for code that works in another
+ * precision, such as the float32 factorization behind MixedPrecisionSystem.
+ * Converts to and from the double Vector.
+ */
+template <typename T>
+class BasicVector {
+    static_assert(std::is_floating_point<T>::value, "BasicVector needs a floating-point scalar");
+public:
+    using value_type = T;
+
+    /** Zero vector of length @p size. */
+    explicit BasicVector(std::size_t size) : mStorage(size) {}
+    /** Element-wise conversion of a double vector. */
+    explicit BasicVector(const Vector& v) : mStorage(v.size()) {
+        std::transform(v.begin(), v.end(), data(), [](double x) { return static_cast<T>(x); });
+    }
+
+    /** Element-wise conversion back to double. */
+    Vector toVector() const {
+        Vector v(size());
+        std::transform(begin(), end(), v.data(), [](T x) { return static_cast<double>(x); });
+        return v;
+    }
+
+    /** 0-based index with bounds check. */
+    T& operator[](std::size_t idx) {
+        if (idx >= size()) throw std::out_of_range("Vector index out of range");
+        return data()[idx];
+    }
+    const T& operator[](std::size_t idx) const {
+        if (idx >= size()) throw std::out_of_range("Vector index out of range");
+        return data()[idx];
+    }
+
+    std::size_t size() const noexcept { return mStorage.size(); }
+
+    /** Unchecked access: raw storage and contiguous iterators. */
+    T*       data() noexcept        { return mStorage.data(); }
+    const T* data() const noexcept  { return mStorage.data(); }
+    T*       begin() noexcept       { return data(); }
+    const T* begin() const noexcept { return data(); }
+    T*       end() noexcept         { return data() + size(); }
+    const T* end() const noexcept   { return data() + size(); }
+
+private:
+    detail::AlignedArray<T> mStorage;
+};
+
+/**
+ * @brief Dynamic row-major matrix over scalar type T.
+ *
+ * Same layout contract as Matrix (dense rows, stride() == cols(), buffer
+ * aligned to Matrix::kAlignment), so raw-buffer kernels such as the float
+ * gemm overload work on it directly. Converts to and from the double Matrix.
+ */
+template <typename T>
+class BasicMatrix {
+    static_assert(std::is_floating_point<T>::value, "BasicMatrix needs a floating-point scalar");
+public:
+    using value_type = T;
+
+    /** rows×cols zero matrix. */
+    BasicMatrix(std::size_t rows, std::size_t cols)
+        : mRows(rows), mCols(cols), mStorage(rows * cols) {}
+    /** Element-wise conversion of a double matrix or view. */
+    explicit BasicMatrix(MatrixView A)
+        : BasicMatrix(A.rows(), A.cols())
+    {
+        for (std::size_t i = 0; i < mRows; ++i)
+            std::transform(A.row(i), A.row(i) + mCols, row(i),
+                           [](double x) { return static_cast<T>(x); });
+    }
+
+    /** Element-wise conversion back to double. */
+    Matrix toMatrix() const {
+        Matrix A(mRows, mCols);
+        for (std::size_t i = 0; i < mRows; ++i)
+            std::transform(row(i), row(i) + mCols, A.row(i),
+                           [](T x) { return static_cast<double>(x); });
+        return A;
+    }
+
+    /** 1-based bounds-checked element access. */
+    T& operator()(std::size_t i, std::size_t j) {
+        if (i == 0 || i > mRows || j == 0 || j > mCols)
+            throw std::out_of_range("Matrix 1-based index out of range");
+        return row(i - 1)[j - 1];
+    }
+    const T& operator()(std::size_t i, std::size_t j) const {
+        if (i == 0 || i > mRows || j == 0 || j > mCols)
+            throw std::out_of_range("Matrix 1-based index out of range");
+        return row(i - 1)[j - 1];
+    }
+
+    std::size_t rows() const noexcept { return mRows; }
+    std::size_t cols() const noexcept { return mCols; }
+    /** Leading dimension: element distance between consecutive rows. */
+    std::size_t stride() const noexcept { return mCols; }
+
+    /** Raw pointer to the row-major buffer. */
+    T*       data() noexcept       { return mStorage.data(); }
+    const T* data() const noexcept { return mStorage.data(); }
+    /** Raw pointer to 0-based row @p i (unchecked). */
+    T*       row(std::size_t i) noexcept       { return data() + i * mCols; }
+    const T* row(std::size_t i) const noexcept { return data() + i * mCols; }
+
+private:
+    std::size_t             mRows, mCols;
+    detail::AlignedArray<T> mStorage;
+};
+
+using FloatVector = BasicVector<float>;
+using FloatMatrix = BasicMatrix<float>;
+
+#endif // BASICMATRIX_HPP
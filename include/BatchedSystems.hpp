@@ -0,0 +1,77 @@
+// include/BatchedSystems.hpp
+#ifndef BATCHEDSYSTEMS_HPP
+#define BATCHEDSYSTEMS_HPP
+
+#include <cstddef>
+#include <vector>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Many independent n×n systems A_s x_s = b_s solved together.
+ *
+ * Storage is interleaved across the batch: element (i,j) of system s lives
+ * at A()[(i*n + j) * stride() + s] and entry i of b_s at b()[i * stride() + s],
+ * so the same element of neighbouring systems is contiguous. The solvers
+ * sweep tiles of kLanes systems in lock-step (one SIMD lane per system)
+ * and spread tiles over the thread pool. Callers can fill A() and b()
+ * directly or use setSystem(). Solving is in place: solutions overwrite
+ * b() and the factorizations overwrite A(), so refill A() before solving
+ * again.
+ *
+ * A system whose factorization breaks down is flagged and its solution is
+ * left unspecified; the others are unaffected.
+ */
+class BatchedSystems {
+public:
+    /** Systems per SIMD tile; stride() is a multiple of this. */
+    static constexpr std::size_t kLanes = 8;
+
+    /** @p count zeroed n×n systems (padding lanes hold identity systems). */
+    BatchedSystems(std::size_t n, std::size_t count);
+
+    std::size_t size() const noexcept;
+    std::size_t count() const noexcept;
+    /** Distance between the same element of consecutive rows of the batch. */
+    std::size_t stride() const noexcept;
+
+    /** Interleaved matrix and right-hand-side buffers. */
+    double*       A() noexcept;
+    const double* A() const noexcept;
+    double*       b() noexcept;
+    const double* b() const noexcept;
+
+    /** Copy one system in (0-based @p s). */
+    void setSystem(std::size_t s, const Matrix& A, const Vector& b);
+    /** Current contents of b_s (the solution after a solve). */
+    Vector solution(std::size_t s) const;
+
+    /**
+     * Solve symmetric positive-definite systems by Cholesky (reads the lower
+     * triangle and overwrites it with L).
+     * @returns number of systems that were not positive definite.
+     */
+    std::size_t solveCholesky();
+    /**
+     * Solve general systems by LU with per-system partial pivoting; A() is
+     * left holding U on and above the diagonal and scratch below it.
+     * @returns number of singular or nearly singular systems.
+     */
+    std::size_t solveLU();
+
+    /** Whether system @p s was solved by the last solve call. */
+    bool succeeded(std::size_t s) const;
+
+private:
+    template <typename TileSolver>
+    std::size_t solveTiles(TileSolver&& solveTile);
+
+    std::size_t                mN;
+    std::size_t                mCount;
+    std::size_t                mStride;
+    std::vector<double>        mA;
+    std::vector<double>        mB;
+    std::vector<unsigned char> mFailed;
+};
+
+#endif // BATCHEDSYSTEMS_HPP
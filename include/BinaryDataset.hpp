@@ -0,0 +1,73 @@
+// include/BinaryDataset.hpp
+#ifndef BINARYDATASET_HPP
+#define BINARYDATASET_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Dataset.hpp"
+#include "MappedFile.hpp"
+#include "Matrix.hpp"
+#include "Span.hpp"
+
+/**
+ * Binary dataset layout (native little-endian):
+ *
+ *   [0, 64)          header: magic "LADSBIN1", version, dtype (1 = float64),
+ *                    rows, cols and the byte offsets of the sections below
+ *   names            cols + 1 length-prefixed column names (features, target)
+ *   features         rows × cols doubles, row-major, 64-byte aligned
+ *   target           rows doubles, 64-byte aligned
+ */
+
+/**
+ * Write X and y in the binary format. @p featureNames may be empty or hold
+ * one name per column.
+ * @throws std::runtime_error on I/O failure, std::length_error on shape mismatch.
+ */
+void writeBinaryDataset(const std::string& path, MatrixView X, Span<const double> y,
+                        const std::vector<std::string>& featureNames = {},
+                        const std::string& targetName = std::string());
+
+/**
+ * Convert a delimited text file to the binary format, chunk by chunk, so the
+ * text never has to fit in memory (only the target column is buffered).
+ * Column names come from the header line when the schema has one.
+ */
+void convertCsvToBinary(const std::string& csvPath, const CsvSchema& schema,
+                        const std::string& binaryPath);
+
+/** True if @p path starts with the binary dataset magic. */
+bool isBinaryDataset(const std::string& path);
+
+/**
+ * @brief Memory-mapped binary dataset exposing zero-copy views.
+ *
+ * Opening validates the header and section bounds only; the data pages are
+ * read by the OS on first touch. Views stay valid while the object lives.
+ */
+class BinaryDataset {
+public:
+    /** @throws std::runtime_error if the file is missing or malformed. */
+    explicit BinaryDataset(const std::string& path);
+
+    std::size_t rows() const noexcept;
+    std::size_t cols() const noexcept;
+
+    /** rows × cols feature matrix straight over the mapping. */
+    MatrixView         features() const noexcept;
+    Span<const double> target() const noexcept;
+
+    const std::vector<std::string>& featureNames() const noexcept;
+    const std::string&              targetName() const noexcept;
+
+private:
+    MappedFile               mFile;
+    std::size_t              mRows, mCols;
+    const double*            mFeatures;
+    const double*            mTarget;
+    std::vector<std::string> mFeatureNames;
+    std::string              mTargetName;
+};
+
+#endif // BINARYDATASET_HPP
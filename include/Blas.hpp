@@ -0,0 +1,74 @@
+// include/Blas.hpp
+#ifndef BLAS_HPP
+#define BLAS_HPP
+
+#include <cstddef>
+#include "Matrix.hpp"
+
+/** Whether a gemm operand is used as stored or transposed. */
+enum class Transpose { No, Yes };
+
+/**
+ * @brief General matrix multiply on raw row-major buffers:
+ *        C = alpha * op(A) * op(B) + beta * C.
+ *
+ * op(A) is m×k, op(B) is k×n and C is m×n; lda, ldb and ldc are the row
+ * strides of the buffers as stored. When beta == 0, C is not read.
+ * The product is cache-blocked, packed and computed by a register-blocked
+ * micro-kernel chosen at runtime (AVX-512, AVX2/FMA or portable scalar).
+ */
+void gemm(Transpose transA, Transpose transB,
+          std::size_t m, std::size_t n, std::size_t k,
+          double alpha, const double* A, std::size_t lda,
+          const double* B, std::size_t ldb,
+          double beta, double* C, std::size_t ldc);
+
+/**
+ * @brief Single-precision gemm on raw row-major buffers. Same blocking and
+ *        contract as the double version; the float micro-kernels cover twice
+ *        as many columns per register.
+ */
+void gemm(Transpose transA, Transpose transB,
+          std::size_t m, std::size_t n, std::size_t k,
+          float alpha, const float* A, std::size_t lda,
+          const float* B, std::size_t ldb,
+          float beta, float* C, std::size_t ldc);
+
+/**
+ * @brief C = alpha * A * B + beta * C into a preallocated A.rows()×B.cols() C.
+ * @throws std::length_error on shape mismatch,
+ *         std::invalid_argument if C aliases A or B.
+ */
+void gemm(double alpha, const Matrix& A, const Matrix& B, double beta, Matrix& C);
+
+/** C = alpha * op(A) * op(B) + beta * C for Matrix operands. */
+void gemm(Transpose transA, Transpose transB, double alpha,
+          const Matrix& A, const Matrix& B, double beta, Matrix& C);
+
+/**
+ * @brief Fused normal-equation kernel on raw row-major buffers:
+ *        G = XᵀX + beta * G and g = Xᵀy + beta * g for an m×n X.
+ *
+ * One pass over the rows of X computes the lower triangle only (rank-1 row
+ * updates for narrow X, gemm panels for wide X), split over threads by row
+ * blocks whose partials are reduced in a fixed order; the upper triangle is
+ * then mirrored. When beta != 0 only the lower triangle of G is read.
+ * y and g may both be null to form the Gram matrix alone.
+ */
+void gram(std::size_t m, std::size_t n, const double* X, std::size_t ldx,
+          const double* y, double beta, double* G, std::size_t ldg, double* g);
+
+/**
+ * @brief G = XᵀX + beta * G, g = Xᵀy + beta * g into a preallocated n×n G
+ *        and length-n g, where n = X.cols().
+ * @throws std::length_error on shape mismatch.
+ */
+void gram(const Matrix& X, const Vector& y, double beta, Matrix& G, Vector& g);
+
+/** G = XᵀX, g = Xᵀy. */
+void gram(const Matrix& X, const Vector& y, Matrix& G, Vector& g);
+
+/** Name of the micro-kernel selected for this CPU ("avx512", "avx2" or "scalar"). */
+const char* gemmKernelName() noexcept;
+
+#endif // BLAS_HPP
@@ -0,0 +1,114 @@
+// include/ConjugateGradient.hpp
+#ifndef CONJUGATEGRADIENT_HPP
+#define CONJUGATEGRADIENT_HPP
+
+#include <cstddef>
+#include <memory>
+#include "LinearOperator.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Preconditioner M ≈ A for conjugate gradient: z = M⁻¹ r.
+ */
+class Preconditioner {
+public:
+    virtual ~Preconditioner();
+    /** Order of M; r and z passed to apply() have this length. */
+    virtual std::size_t size() const noexcept = 0;
+    /**
+     * z = M⁻¹ r. Called once per CG iteration; must not allocate.
+     * @throws std::length_error if r or z is not of length size().
+     */
+    virtual void apply(const Vector& r, Vector& z) const = 0;
+};
+
+/**
+ * @brief Diagonal (Jacobi) preconditioner, M = diag(A).
+ *
+ * Cheap and effective when features have very different scales.
+ */
+class JacobiPreconditioner : public Preconditioner {
+public:
+    /** @throws std::invalid_argument if A is not square or has a zero diagonal. */
+    explicit JacobiPreconditioner(const Matrix& A);
+    /** Build from an explicit diagonal. */
+    explicit JacobiPreconditioner(const Vector& diagonal);
+    std::size_t size() const noexcept override;
+    void apply(const Vector& r, Vector& z) const override;
+
+private:
+    Vector mInvDiag;
+};
+
+/**
+ * @brief Zero-fill incomplete Cholesky, M = L·Lᵀ with L restricted to the
+ *        nonzero pattern of the lower triangle of A.
+ *
+ * On a fully dense A this is the exact Cholesky factor.
+ */
+class IncompleteCholeskyPreconditioner : public Preconditioner {
+public:
+    /** @throws std::runtime_error if a pivot becomes non-positive. */
+    explicit IncompleteCholeskyPreconditioner(const Matrix& A);
+    std::size_t size() const noexcept override;
+    void apply(const Vector& r, Vector& z) const override;
+
+private:
+    Matrix mL;
+};
+
+/** Stopping rules for conjugate gradient. */
+struct CGOptions {
+    /** Stop once ||r|| <= max(absTol, relTol * ||b||). */
+    double      relTol  = 1e-10;
+    double      absTol  = 0.0;
+    /** Iteration cap; 0 means 10 × the system size. */
+    std::size_t maxIter = 0;
+};
+
+/** Outcome of a conjugate-gradient solve. */
+struct CGResult {
+    std::size_t iterations   = 0;
+    double      residualNorm = 0.0;
+    bool        converged    = false;
+};
+
+/**
+ * @brief Reusable (preconditioned) conjugate-gradient engine for SPD systems.
+ *
+ * Work vectors are allocated once by the constructor, so solve() runs
+ * without heap allocation. A (any square LinearOperator, or a dense Matrix)
+ * and the preconditioner are referenced, not copied, and must outlive the
+ * engine.
+ */
+class ConjugateGradient {
+public:
+    /**
+     * @throws std::invalid_argument if A is not square,
+     *         std::length_error if the preconditioner's size differs from A's.
+     */
+    ConjugateGradient(const LinearOperator& A, const CGOptions& options = CGOptions(),
+                      const Preconditioner* preconditioner = nullptr);
+    /** Dense convenience overload; wraps A in a DenseOperator. */
+    ConjugateGradient(const Matrix& A, const CGOptions& options = CGOptions(),
+                      const Preconditioner* preconditioner = nullptr);
+
+    /**
+     * Solve A x = b using the incoming x as the initial guess (warm start);
+     * x is overwritten with the final iterate.
+     */
+    CGResult solve(const Vector& b, Vector& x);
+
+    const CGOptions& options() const noexcept;
+    void setOptions(const CGOptions& options);
+
+private:
+    std::unique_ptr<DenseOperator> mDense;   // owned only by the Matrix overload
+    const LinearOperator*          mA;
+    CGOptions                      mOptions;
+    const Preconditioner*          mPreconditioner;
+    Vector                         mR, mZ, mP, mAp;
+};
+
+#endif // CONJUGATEGRADIENT_HPP
@@ -0,0 +1,62 @@
+// include/CrossValidation.hpp
+#ifndef CROSSVALIDATION_HPP
+#define CROSSVALIDATION_HPP
+
+#include <cstddef>
+#include <vector>
+#include "Matrix.hpp"
+#include "Span.hpp"
+
+/** Mean and sample variance of one metric over all evaluated folds. */
+struct MetricSummary {
+    double mean     = 0.0;
+    double variance = 0.0;
+};
+
+/** Scores of one (seed, fold) split. */
+struct FoldScore {
+    unsigned    seed      = 0;
+    std::size_t fold      = 0;
+    std::size_t trainRows = 0;
+    std::size_t testRows  = 0;
+    double      trainRmse = 0.0;
+    double      testRmse  = 0.0;
+    double      testMae   = 0.0;
+};
+
+/** Settings for crossValidate. */
+struct CrossValidationOptions {
+    /** Number of folds k (at least 2). */
+    std::size_t folds = 5;
+    /** One shuffled k-fold partition per seed (repeated k-fold). */
+    std::vector<unsigned> seeds = { 42 };
+    /** Ridge penalty added to the diagonal of each training XᵀX. */
+    double ridge = 0.0;
+};
+
+/** Per-split scores (seed-major, fold-minor) and their summaries. */
+struct CrossValidationResult {
+    std::vector<FoldScore> folds;
+    MetricSummary          trainRmse;
+    MetricSummary          testRmse;
+    MetricSummary          testMae;
+};
+
+/**
+ * @brief Repeated k-fold cross-validation of a least-squares fit of y on X.
+ *
+ * For each seed the rows are shuffled (std::mt19937 + std::shuffle) and cut
+ * into k contiguous folds. Every fold's normal equations are accumulated
+ * once, in parallel; each training set is then the seed's total minus its
+ * held-out fold, so XᵀX is never rebuilt per fold. Fits and held-out
+ * scoring run in parallel over all (seed, fold) pairs, and results do not
+ * depend on the thread count.
+ * @throws std::length_error if y and X disagree,
+ *         std::invalid_argument for fewer than 2 folds, more folds than
+ *         rows or no seeds, std::runtime_error if a training XᵀX (plus
+ *         ridge) is not positive definite.
+ */
+CrossValidationResult crossValidate(MatrixView X, Span<const double> y,
+                                    const CrossValidationOptions& options = {});
+
+#endif // CROSSVALIDATION_HPP
@@ -0,0 +1,79 @@
+// include/Dataset.hpp
+#ifndef DATASET_HPP
+#define DATASET_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "MappedFile.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/** What a delimited-text column is used for. */
+enum class ColumnRole { Feature, Target, Ignore };
+
+/**
+ * @brief Column layout of a delimited text file.
+ *
+ * One role per field; every record must have exactly that many fields.
+ * Ignored fields are skipped without being parsed, so they may hold text.
+ */
+struct CsvSchema {
+    std::vector<ColumnRole> columns;
+    char delimiter = ',';
+    /** Skip the first line. */
+    bool header    = false;
+    /** Append a constant 1.0 feature after the parsed ones. */
+    bool intercept = false;
+
+    /** Columns of the feature matrix (Feature columns, plus the intercept). */
+    std::size_t features() const noexcept;
+};
+
+/** Design matrix (one row per record) and target vector. */
+struct Dataset {
+    Matrix X;
+    Vector y;
+};
+
+/**
+ * @brief Parse delimited text held in memory.
+ *
+ * Numbers are read with std::from_chars straight into the output buffers.
+ * Large inputs are cut into line-aligned chunks that are counted, then
+ * parsed, in parallel. Blank lines are skipped; CRLF line ends are fine.
+ * @throws std::invalid_argument unless the schema has exactly one Target,
+ *         std::runtime_error on malformed records (message names the line).
+ */
+Dataset parseCsv(std::string_view text, const CsvSchema& schema);
+
+/** Memory-map @p path and parse it with parseCsv(). */
+Dataset readCsv(const std::string& path, const CsvSchema& schema);
+
+/**
+ * @brief Sequential chunked reader over a memory-mapped delimited file.
+ *
+ * For out-of-core fits: each readChunk() parses the next rows into caller
+ * buffers that are reused, so only the current chunk is ever materialized.
+ */
+class CsvReader {
+public:
+    /** @throws as readCsv(). */
+    CsvReader(const std::string& path, const CsvSchema& schema);
+
+    /**
+     * Parse up to X.rows() further records into X (schema.features() columns)
+     * and y.
+     * @returns rows written; 0 once the file is exhausted.
+     */
+    std::size_t readChunk(Matrix& X, Vector& y);
+
+private:
+    MappedFile  mFile;
+    CsvSchema   mSchema;
+    std::size_t mOffset;
+    std::size_t mLine;
+};
+
+#endif // DATASET_HPP
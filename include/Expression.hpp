@@ -0,0 +1,276 @@
+// include/Expression.hpp
+#ifndef EXPRESSION_HPP
+#define EXPRESSION_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+class Vector;
+class Matrix;
+
+/**
+ * @brief Lazy element-wise arithmetic for Vector and Matrix.
+ *
+ * a + b, a - b, -a, a * s and s * a build a small expression tree instead
+ * of a temporary; the tree is evaluated in one fused loop when it is
+ * assigned to, or used to construct, a Vector or Matrix. So x + p * alpha
+ * reads x and p once and writes the result once, with no intermediate
+ * storage. Shapes are checked when a node is built. Named operands are
+ * held by reference and temporaries are moved into the tree, so an
+ * expression kept with auto stays valid as long as its named operands.
+ * Every node reads its operands at its own index only, which makes
+ * x = x + p * alpha safe.
+ */
+namespace expr {
+
+struct Add { static double apply(double a, double b) noexcept { return a + b; } };
+struct Sub { static double apply(double a, double b) noexcept { return a - b; } };
+
+// Vector leaves and nodes: size() and unchecked coeff(i).
+template <typename V>
+struct VectorRef {
+    const V* v;
+    std::size_t size() const noexcept { return v->size(); }
+    double coeff(std::size_t i) const noexcept { return v->data()[i]; }
+};
+
+template <typename V>
+struct VectorOwned {
+    V v;
+    std::size_t size() const noexcept { return v.size(); }
+    double coeff(std::size_t i) const noexcept { return v.data()[i]; }
+};
+
+template <typename Op, typename L, typename R>
+struct VectorBinary {
+    L l;
+    R r;
+    std::size_t size() const noexcept { return l.size(); }
+    double coeff(std::size_t i) const noexcept { return Op::apply(l.coeff(i), r.coeff(i)); }
+};
+
+template <typename E>
+struct VectorScale {
+    E e;
+    double s;
+    std::size_t size() const noexcept { return e.size(); }
+    double coeff(std::size_t i) const noexcept { return e.coeff(i) * s; }
+};
+
+// Matrix leaves and nodes: rows(), cols() and unchecked 0-based coeff(i, j).
+template <typename M>
+struct MatrixRef {
+    const M* m;
+    std::size_t rows() const noexcept { return m->rows(); }
+    std::size_t cols() const noexcept { return m->cols(); }
+    double coeff(std::size_t i, std::size_t j) const noexcept { return m->row(i)[j]; }
+};
+
+template <typename M>
+struct MatrixOwned {
+    M m;
+    std::size_t rows() const noexcept { return m.rows(); }
+    std::size_t cols() const noexcept { return m.cols(); }
+    double coeff(std::size_t i, std::size_t j) const noexcept { return m.row(i)[j]; }
+};
+
+template <typename Op, typename L, typename R>
+struct MatrixBinary {
+    L l;
+    R r;
+    std::size_t rows() const noexcept { return l.rows(); }
+    std::size_t cols() const noexcept { return l.cols(); }
+    double coeff(std::size_t i, std::size_t j) const noexcept {
+        return Op::apply(l.coeff(i, j), r.coeff(i, j));
+    }
+};
+
+template <typename E>
+struct MatrixScale {
+    E e;
+    double s;
+    std::size_t rows() const noexcept { return e.rows(); }
+    std::size_t cols() const noexcept { return e.cols(); }
+    double coeff(std::size_t i, std::size_t j) const noexcept { return e.coeff(i, j) * s; }
+};
+
+} // namespace expr
+
+/** Unevaluated element-wise Vector expression; converts to Vector. */
+template <typename Node>
+class VectorExpression {
+public:
+    explicit VectorExpression(Node node) : mNode(std::move(node)) {}
+
+    std::size_t size() const noexcept { return mNode.size(); }
+    /** Unchecked 0-based element (evaluated on the fly). */
+    double coeff(std::size_t i) const noexcept { return mNode.coeff(i); }
+    /** Materialize into a Vector. */
+    Vector eval() const;   // defined in Vector.hpp
+
+    /** 0-based element with bounds check. */
+    double operator[](std::size_t idx) const {
+        if (idx >= size()) throw std::out_of_range("Vector index out of range");
+        return coeff(idx);
+    }
+    /** 1-based element with bounds check. */
+    double operator()(std::size_t idx) const {
+        if (idx == 0 || idx > size()) throw std::out_of_range("Vector 1-based index out of range");
+        return coeff(idx - 1);
+    }
+
+private:
+    Node mNode;
+};
+
+/** Unevaluated element-wise Matrix expression; converts to Matrix. */
+template <typename Node>
+class MatrixExpression {
+public:
+    explicit MatrixExpression(Node node) : mNode(std::move(node)) {}
+
+    std::size_t rows() const noexcept { return mNode.rows(); }
+    std::size_t cols() const noexcept { return mNode.cols(); }
+    /** Unchecked 0-based element (evaluated on the fly). */
+    double coeff(std::size_t i, std::size_t j) const noexcept { return mNode.coeff(i, j); }
+    /** Materialize into a Matrix. */
+    Matrix eval() const;   // defined in Matrix.hpp
+
+    /** 1-based element with bounds check. */
+    double operator()(std::size_t i, std::size_t j) const {
+        if (i == 0 || i > rows() || j == 0 || j > cols())
+            throw std::out_of_range("Matrix 1-based index out of range");
+        return coeff(i - 1, j - 1);
+    }
+
+private:
+    Node mNode;
+};
+
+namespace expr {
+
+template <typename T> struct IsVectorExpression : std::false_type {};
+template <typename N> struct IsVectorExpression<VectorExpression<N>> : std::true_type {};
+template <typename T> struct IsMatrixExpression : std::false_type {};
+template <typename N> struct IsMatrixExpression<MatrixExpression<N>> : std::true_type {};
+
+template <typename T>
+constexpr bool isVectorOperand = std::is_same<std::decay_t<T>, Vector>::value
+                              || IsVectorExpression<std::decay_t<T>>::value;
+template <typename T>
+constexpr bool isMatrixOperand = std::is_same<std::decay_t<T>, Matrix>::value
+                              || IsMatrixExpression<std::decay_t<T>>::value;
+
+/** Tree node for an operand: expressions by value, named containers by
+ *  reference, temporaries moved in. */
+template <typename T>
+auto vectorOperand(T&& t) {
+    using D = std::decay_t<T>;
+    if constexpr (IsVectorExpression<D>::value)
+        return D(std::forward<T>(t));
+    else if constexpr (std::is_lvalue_reference<T>::value)
+        return VectorRef<D>{ &t };
+    else
+        return VectorOwned<D>{ std::move(t) };
+}
+
+template <typename T>
+auto matrixOperand(T&& t) {
+    using D = std::decay_t<T>;
+    if constexpr (IsMatrixExpression<D>::value)
+        return D(std::forward<T>(t));
+    else if constexpr (std::is_lvalue_reference<T>::value)
+        return MatrixRef<D>{ &t };
+    else
+        return MatrixOwned<D>{ std::move(t) };
+}
+
+template <typename Op, typename L, typename R>
+auto vectorBinary(L&& l, R&& r, const char* mismatch) {
+    auto a = vectorOperand(std::forward<L>(l));
+    auto b = vectorOperand(std::forward<R>(r));
+    if (a.size() != b.size())
+        throw std::length_error(mismatch);
+    using Node = VectorBinary<Op, decltype(a), decltype(b)>;
+    return VectorExpression<Node>(Node{ std::move(a), std::move(b) });
+}
+
+template <typename E>
+auto vectorScale(E&& e, double s) {
+    auto a = vectorOperand(std::forward<E>(e));
+    using Node = VectorScale<decltype(a)>;
+    return VectorExpression<Node>(Node{ std::move(a), s });
+}
+
+template <typename Op, typename L, typename R>
+auto matrixBinary(L&& l, R&& r) {
+    auto a = matrixOperand(std::forward<L>(l));
+    auto b = matrixOperand(std::forward<R>(r));
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+        throw std::length_error("Matrix size mismatch");
+    using Node = MatrixBinary<Op, decltype(a), decltype(b)>;
+    return MatrixExpression<Node>(Node{ std::move(a), std::move(b) });
+}
+
+template <typename E>
+auto matrixScale(E&& e, double s) {
+    auto a = matrixOperand(std::forward<E>(e));
+    using Node = MatrixScale<decltype(a)>;
+    return MatrixExpression<Node>(Node{ std::move(a), s });
+}
+
+} // namespace expr
+
+// Vector operators: any mix of Vector and VectorExpression operands.
+template <typename L, typename R,
+          std::enable_if_t<expr::isVectorOperand<L> && expr::isVectorOperand<R>, int> = 0>
+auto operator+(L&& l, R&& r) {
+    return expr::vectorBinary<expr::Add>(std::forward<L>(l), std::forward<R>(r),
+                                         "Vector size mismatch in addition");
+}
+
+template <typename L, typename R,
+          std::enable_if_t<expr::isVectorOperand<L> && expr::isVectorOperand<R>, int> = 0>
+auto operator-(L&& l, R&& r) {
+    return expr::vectorBinary<expr::Sub>(std::forward<L>(l), std::forward<R>(r),
+                                         "Vector size mismatch in subtraction");
+}
+
+template <typename E, std::enable_if_t<expr::isVectorOperand<E>, int> = 0>
+auto operator*(E&& e, double s) { return expr::vectorScale(std::forward<E>(e), s); }
+
+template <typename E, std::enable_if_t<expr::isVectorOperand<E>, int> = 0>
+auto operator*(double s, E&& e) { return expr::vectorScale(std::forward<E>(e), s); }
+
+template <typename E, std::enable_if_t<expr::isVectorOperand<E>, int> = 0>
+auto operator-(E&& e) { return expr::vectorScale(std::forward<E>(e), -1.0); }
+
+template <typename E, std::enable_if_t<expr::isVectorOperand<E>, int> = 0>
+auto operator+(E&& e) { return expr::vectorScale(std::forward<E>(e), 1.0); }
+
+// Matrix operators: any mix of Matrix and MatrixExpression operands.
+// Products are not element-wise; they stay eager (see Matrix.hpp).
+template <typename L, typename R,
+          std::enable_if_t<expr::isMatrixOperand<L> && expr::isMatrixOperand<R>, int> = 0>
+auto operator+(L&& l, R&& r) {
+    return expr::matrixBinary<expr::Add>(std::forward<L>(l), std::forward<R>(r));
+}
+
+template <typename L, typename R,
+          std::enable_if_t<expr::isMatrixOperand<L> && expr::isMatrixOperand<R>, int> = 0>
+auto operator-(L&& l, R&& r) {
+    return expr::matrixBinary<expr::Sub>(std::forward<L>(l), std::forward<R>(r));
+}
+
+template <typename E, std::enable_if_t<expr::isMatrixOperand<E>, int> = 0>
+auto operator*(E&& e, double s) { return expr::matrixScale(std::forward<E>(e), s); }
+
+template <typename E, std::enable_if_t<expr::isMatrixOperand<E>, int> = 0>
+auto operator*(double s, E&& e) { return expr::matrixScale(std::forward<E>(e), s); }
+
+template <typename E, std::enable_if_t<expr::isMatrixOperand<E>, int> = 0>
+auto operator-(E&& e) { return expr::matrixScale(std::forward<E>(e), -1.0); }
+
+#endif // EXPRESSION_HPP
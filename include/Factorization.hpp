@@ -0,0 +1,206 @@
+// include/Factorization.hpp
+#ifndef FACTORIZATION_HPP
+#define FACTORIZATION_HPP
+
+#include <cstddef>
+#include <vector>
+#include "BasicMatrix.hpp"
+#include "Matrix.hpp"
+#include "Span.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief LU factorization with partial pivoting over scalar type T.
+ *
+ * Computed once by a right-looking blocked algorithm whose trailing updates
+ * go through gemm (float and double); afterwards any number of right-hand
+ * sides can be solved in O(n²) each. A pivot counts as zero when it is at
+ * most n·ε(T) times the largest entry of its original column, so the test
+ * follows the working precision and ignores how the columns are scaled.
+ * For float the trailing updates run through the single-precision gemm,
+ * which streams half the bytes and fits twice the lanes per register;
+ * MixedPrecisionSystem builds on it. Instantiated for float, double and
+ * long double (plain loops for the last).
+ */
+template <typename T>
+class BasicLUFactorization {
+public:
+    /** Columns factored per panel before the trailing update. */
+    static constexpr std::size_t kBlockSize = 64;
+
+    /**
+     * Factor square matrix A.
+     * @throws std::invalid_argument if A is not square,
+     *         std::runtime_error if A is singular or nearly singular.
+     */
+    explicit BasicLUFactorization(const BasicMatrix<T>& A);
+
+    /** @returns x with A x = b. */
+    BasicVector<T> solve(const BasicVector<T>& b) const;
+    /** Overwrite b with the solution of A x = b (no allocation). */
+    void solveInPlace(BasicVector<T>& b) const;
+    /**
+     * Overwrite x with the solution of A x = b, b given in x (no allocation).
+     * @throws std::invalid_argument if x.size() != size().
+     */
+    void solveInPlace(Span<T> x) const;
+
+    /** det(A) from the diagonal of U and the pivot parity. */
+    T determinant() const;
+
+    /** Packed factors: unit-lower L below the diagonal, U on and above it. */
+    const BasicMatrix<T>& factors() const noexcept { return mLU; }
+    /** LAPACK-style pivots: step k swapped rows k and pivots()[k] (0-based). */
+    const std::vector<std::size_t>& pivots() const noexcept { return mPivots; }
+    /** Order of the factored matrix. */
+    std::size_t size() const noexcept { return mLU.rows(); }
+
+private:
+    BasicMatrix<T>           mLU;
+    std::vector<std::size_t> mPivots;
+};
+
+extern template class BasicLUFactorization<float>;
+extern template class BasicLUFactorization<double>;
+extern template class BasicLUFactorization<long double>;
+
+/**
+ * @brief LU factorization with partial pivoting, P·A = L·U, in double.
+ *
+ * The Matrix / Vector front end of BasicLUFactorization<double>: factoring
+ * and single right-hand-side solves are delegated to it; multi-column
+ * right-hand sides, determinant and inverse reuse the same factors.
+ */
+class LUFactorization {
+public:
+    /** Columns factored per panel before the trailing gemm update. */
+    static constexpr std::size_t kBlockSize = BasicLUFactorization<double>::kBlockSize;
+
+    /**
+     * Factor square matrix A.
+     * @throws std::invalid_argument if A is not square,
+     *         std::runtime_error if A is singular or nearly singular.
+     */
+    explicit LUFactorization(const Matrix& A);
+
+    /** @returns x with A x = b. */
+    Vector solve(const Vector& b) const;
+    /** Overwrite b with the solution of A x = b (no allocation). */
+    void solveInPlace(Vector& b) const;
+    /** @returns X with A X = B, one column per right-hand side. */
+    Matrix solve(const Matrix& B) const;
+    /** Overwrite B with the solution of A X = B (no allocation). */
+    void solveInPlace(Matrix& B) const;
+
+    /** det(A) from the diagonal of U and the pivot parity. */
+    double determinant() const;
+    /** A⁻¹, solved column-block-wise from the stored factors. */
+    Matrix inverse() const;
+
+    /** Packed factors: unit-lower L below the diagonal, U on and above it. */
+    const BasicMatrix<double>& factors() const noexcept;
+    /** LAPACK-style pivots: step k swapped rows k and pivots()[k] (0-based). */
+    const std::vector<std::size_t>& pivots() const noexcept;
+    /** Order of the factored matrix. */
+    std::size_t size() const noexcept;
+
+private:
+    BasicLUFactorization<double> mLU;
+};
+
+/**
+ * @brief Cholesky factorization A = L·Lᵀ of a symmetric positive-definite matrix.
+ *
+ * Only the lower triangle of A is read. Blocked like LUFactorization, with
+ * the trailing lower-triangle update done through gemm.
+ */
+class CholeskyFactorization {
+public:
+    /** Columns factored per panel before the trailing gemm update. */
+    static constexpr std::size_t kBlockSize = 64;
+
+    /**
+     * Factor A.
+     * @throws std::invalid_argument if A is not square,
+     *         std::runtime_error if A is not positive definite.
+     */
+    explicit CholeskyFactorization(const Matrix& A);
+
+    /** @returns x with A x = b. */
+    Vector solve(const Vector& b) const;
+    /** Overwrite b with the solution of A x = b (no allocation). */
+    void solveInPlace(Vector& b) const;
+    /** @returns X with A X = B. */
+    Matrix solve(const Matrix& B) const;
+    /** Overwrite B with the solution of A X = B (no allocation). */
+    void solveInPlace(Matrix& B) const;
+
+    /** Lower-triangular factor L (upper triangle is zero). */
+    const Matrix& factor() const noexcept;
+    /** Order of the factored matrix. */
+    std::size_t size() const noexcept;
+
+private:
+    Matrix mL;
+};
+
+/**
+ * @brief Householder QR factorization A = Q·R of a tall m×n matrix (m >= n).
+ *
+ * Used for least squares directly on the design matrix, which avoids
+ * squaring the condition number as the normal equations do. Reflectors are
+ * applied row by row so the m-long loops stream the row-major storage.
+ */
+class QRFactorization {
+public:
+    /**
+     * Factor A.
+     * @throws std::invalid_argument if A has more columns than rows,
+     *         std::runtime_error if A is rank deficient.
+     */
+    explicit QRFactorization(const Matrix& A);
+
+    /** @returns x minimising ||A x - b||₂ (length cols()). */
+    Vector solve(const Vector& b) const;
+    /** Overwrite b (length rows()) with Qᵀ b. */
+    void applyQt(Vector& b) const;
+    /** The n×n upper-triangular factor R. */
+    Matrix R() const;
+
+    std::size_t rows() const noexcept;
+    std::size_t cols() const noexcept;
+
+private:
+    Matrix mQR;   // R on/above the diagonal, reflector tails below it
+    Vector mTau;  // reflector scales; H_k = I - tau_k v_k v_kᵀ with v_k[k] = 1
+};
+
+/**
+ * @brief Thin singular value decomposition A = U·diag(s)·Vᵀ.
+ *
+ * One-sided Jacobi: pairs of columns are rotated until mutually orthogonal,
+ * working on the transposed copy so every rotation streams contiguous rows.
+ * For an m×n A with k = min(m,n), U is m×k, V is n×k and s holds k values
+ * in descending order.
+ */
+class SVDFactorization {
+public:
+    explicit SVDFactorization(const Matrix& A);
+
+    const Matrix& U() const noexcept;
+    const Matrix& V() const noexcept;
+    const Vector& singularValues() const noexcept;
+
+    /** Default rank cutoff: max(m,n) · machine epsilon · largest singular value. */
+    double defaultTolerance() const noexcept;
+    /** Number of singular values above @p tol (negative: defaultTolerance()). */
+    std::size_t rank(double tol = -1.0) const;
+    /** Moore–Penrose pseudo-inverse, dropping singular values <= @p tol. */
+    Matrix pseudoInverse(double tol = -1.0) const;
+
+private:
+    Matrix mU, mV;
+    Vector mS;
+};
+
+#endif // FACTORIZATION_HPP
@@ -0,0 +1,341 @@
+// include/FixedMatrix.hpp
+#ifndef FIXEDMATRIX_HPP
+#define FIXEDMATRIX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Length-N vector with inline (stack) storage.
+ *
+ * The size is a compile-time constant, so loops over it have constant trip
+ * counts the compiler can unroll and keep in registers. Converts to and
+ * from the dynamic Vector.
+ */
+template <std::size_t N>
+class FixedVector {
+    static_assert(N > 0, "FixedVector needs at least one element");
+public:
+    /** Zero vector. */
+    constexpr FixedVector() noexcept : mData{} {}
+    /**
+     * Copy of a dynamic vector.
+     * @throws std::length_error if v.size() != N.
+     */
+    explicit FixedVector(const Vector& v) : mData{} {
+        if (v.size() != N)
+            throw std::length_error("Vector size does not match FixedVector");
+        for (std::size_t i = 0; i < N; ++i)
+            mData[i] = v.data()[i];
+    }
+
+    static constexpr std::size_t size() noexcept { return N; }
+
+    /** 0-based index with bounds check. */
+    constexpr double& operator[](std::size_t idx) {
+        if (idx >= N) throw std::out_of_range("Vector index out of range");
+        return mData[idx];
+    }
+    constexpr const double& operator[](std::size_t idx) const {
+        if (idx >= N) throw std::out_of_range("Vector index out of range");
+        return mData[idx];
+    }
+
+    /** Unchecked access to the inline storage. */
+    constexpr double*       data() noexcept       { return mData; }
+    constexpr const double* data() const noexcept { return mData; }
+
+    constexpr FixedVector& operator+=(const FixedVector& rhs) noexcept {
+        for (std::size_t i = 0; i < N; ++i) mData[i] += rhs.mData[i];
+        return *this;
+    }
+    constexpr FixedVector& operator-=(const FixedVector& rhs) noexcept {
+        for (std::size_t i = 0; i < N; ++i) mData[i] -= rhs.mData[i];
+        return *this;
+    }
+    constexpr FixedVector& operator*=(double s) noexcept {
+        for (std::size_t i = 0; i < N; ++i) mData[i] *= s;
+        return *this;
+    }
+    constexpr double dot(const FixedVector& rhs) const noexcept {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < N; ++i) sum += mData[i] * rhs.mData[i];
+        return sum;
+    }
+
+    /** Copy into a dynamic Vector. */
+    Vector toVector() const {
+        Vector v(N);
+        for (std::size_t i = 0; i < N; ++i) v.data()[i] = mData[i];
+        return v;
+    }
+
+private:
+    double mData[N];
+};
+
+/**
+ * @brief R×C row-major matrix with inline (stack) storage.
+ *
+ * Element (i,j) lives at data()[(i-1)*C + (j-1)], the layout of a Matrix
+ * with stride C. Dimensions are compile-time constants; operator() keeps
+ * Matrix's 1-based bounds checks, row() is unchecked.
+ */
+template <std::size_t R, std::size_t C>
+class FixedMatrix {
+    static_assert(R > 0 && C > 0, "FixedMatrix needs at least one element");
+public:
+    /** Zero matrix. */
+    constexpr FixedMatrix() noexcept : mData{} {}
+    /**
+     * Copy of a dynamic matrix (or view).
+     * @throws std::length_error if the shape is not R×C.
+     */
+    explicit FixedMatrix(MatrixView m) : mData{} {
+        if (m.rows() != R || m.cols() != C)
+            throw std::length_error("Matrix shape does not match FixedMatrix");
+        for (std::size_t i = 0; i < R; ++i)
+            for (std::size_t j = 0; j < C; ++j)
+                mData[i * C + j] = m.row(i)[j];
+    }
+
+    static constexpr FixedMatrix identity() noexcept {
+        FixedMatrix I;
+        for (std::size_t i = 0; i < (R < C ? R : C); ++i) I.mData[i * C + i] = 1.0;
+        return I;
+    }
+
+    static constexpr std::size_t rows() noexcept { return R; }
+    static constexpr std::size_t cols() noexcept { return C; }
+
+    /** 1-based bounds-checked element access. */
+    constexpr double& operator()(std::size_t i, std::size_t j) {
+        if (i == 0 || i > R || j == 0 || j > C)
+            throw std::out_of_range("Matrix 1-based index out of range");
+        return mData[(i - 1) * C + (j - 1)];
+    }
+    constexpr const double& operator()(std::size_t i, std::size_t j) const {
+        if (i == 0 || i > R || j == 0 || j > C)
+            throw std::out_of_range("Matrix 1-based index out of range");
+        return mData[(i - 1) * C + (j - 1)];
+    }
+
+    /** Raw pointer to 0-based row @p i (unchecked). */
+    constexpr double*       row(std::size_t i) noexcept       { return mData + i * C; }
+    constexpr const double* row(std::size_t i) const noexcept { return mData + i * C; }
+    constexpr double*       data() noexcept       { return mData; }
+    constexpr const double* data() const noexcept { return mData; }
+
+    constexpr FixedMatrix& operator+=(const FixedMatrix& rhs) noexcept {
+        for (std::size_t k = 0; k < R * C; ++k) mData[k] += rhs.mData[k];
+        return *this;
+    }
+    constexpr FixedMatrix& operator-=(const FixedMatrix& rhs) noexcept {
+        for (std::size_t k = 0; k < R * C; ++k) mData[k] -= rhs.mData[k];
+        return *this;
+    }
+    constexpr FixedMatrix& operator*=(double s) noexcept {
+        for (std::size_t k = 0; k < R * C; ++k) mData[k] *= s;
+        return *this;
+    }
+
+    constexpr FixedMatrix<C, R> transpose() const noexcept {
+        FixedMatrix<C, R> T;
+        for (std::size_t i = 0; i < R; ++i)
+            for (std::size_t j = 0; j < C; ++j)
+                T.row(j)[i] = mData[i * C + j];
+        return T;
+    }
+
+    /** Copy into a dynamic Matrix. */
+    Matrix toMatrix() const {
+        Matrix m(R, C);
+        for (std::size_t i = 0; i < R; ++i)
+            for (std::size_t j = 0; j < C; ++j)
+                m.row(i)[j] = mData[i * C + j];
+        return m;
+    }
+    /** Zero-copy read-only view, e.g. to pass to Matrix-based code. */
+    MatrixView view() const noexcept { return MatrixView(mData, R, C, C); }
+
+private:
+    double mData[R * C];
+};
+
+// Arithmetic returns by value; everything stays on the stack.
+template <std::size_t N>
+constexpr FixedVector<N> operator+(FixedVector<N> a, const FixedVector<N>& b) noexcept { return a += b; }
+template <std::size_t N>
+constexpr FixedVector<N> operator-(FixedVector<N> a, const FixedVector<N>& b) noexcept { return a -= b; }
+template <std::size_t N>
+constexpr FixedVector<N> operator*(FixedVector<N> a, double s) noexcept { return a *= s; }
+template <std::size_t N>
+constexpr FixedVector<N> operator*(double s, FixedVector<N> a) noexcept { return a *= s; }
+
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator+(FixedMatrix<R, C> a, const FixedMatrix<R, C>& b) noexcept { return a += b; }
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator-(FixedMatrix<R, C> a, const FixedMatrix<R, C>& b) noexcept { return a -= b; }
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(FixedMatrix<R, C> a, double s) noexcept { return a *= s; }
+template <std::size_t R, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(double s, FixedMatrix<R, C> a) noexcept { return a *= s; }
+
+/** Matrix product; the k-loop is innermost over a contiguous row of B. */
+template <std::size_t R, std::size_t K, std::size_t C>
+constexpr FixedMatrix<R, C> operator*(const FixedMatrix<R, K>& A, const FixedMatrix<K, C>& B) noexcept {
+    FixedMatrix<R, C> out;
+    for (std::size_t i = 0; i < R; ++i)
+        for (std::size_t k = 0; k < K; ++k) {
+            const double a = A.row(i)[k];
+            for (std::size_t j = 0; j < C; ++j)
+                out.row(i)[j] += a * B.row(k)[j];
+        }
+    return out;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr FixedVector<R> operator*(const FixedMatrix<R, C>& A, const FixedVector<C>& x) noexcept {
+    FixedVector<R> y;
+    for (std::size_t i = 0; i < R; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < C; ++j)
+            sum += A.row(i)[j] * x.data()[j];
+        y.data()[i] = sum;
+    }
+    return y;
+}
+
+/**
+ * @brief LU factorization with partial pivoting of a fixed-size matrix.
+ *
+ * The unblocked counterpart of LUFactorization for small N: no heap
+ * allocation, constant loop bounds, same relative pivot test (at most N·ε
+ * times the largest entry of the pivot's original column is singular).
+ */
+template <std::size_t N>
+class FixedLUFactorization {
+public:
+    /** @throws std::runtime_error if A is singular or nearly singular. */
+    explicit FixedLUFactorization(const FixedMatrix<N, N>& A) : mLU(A), mPivots{} {
+        double tol[N] = {};
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                tol[j] = std::max(tol[j], std::abs(A.row(i)[j]));
+        for (std::size_t j = 0; j < N; ++j)
+            tol[j] *= double(N) * std::numeric_limits<double>::epsilon();
+        for (std::size_t k = 0; k < N; ++k) {
+            std::size_t pivot = k;
+            double maxVal = std::abs(mLU.row(k)[k]);
+            for (std::size_t i = k + 1; i < N; ++i) {
+                const double val = std::abs(mLU.row(i)[k]);
+                if (val > maxVal) { maxVal = val; pivot = i; }
+            }
+            if (!(maxVal > tol[k]))   // also rejects zero columns and NaN
+                throw std::runtime_error("Matrix is singular or nearly singular");
+            mPivots[k] = pivot;
+            if (pivot != k)
+                for (std::size_t j = 0; j < N; ++j)
+                    std::swap(mLU.row(k)[j], mLU.row(pivot)[j]);
+            const double* rk = mLU.row(k);
+            for (std::size_t i = k + 1; i < N; ++i) {
+                double* ri = mLU.row(i);
+                const double l = ri[k] / rk[k];
+                ri[k] = l;
+                for (std::size_t j = k + 1; j < N; ++j)
+                    ri[j] -= l * rk[j];
+            }
+        }
+    }
+
+    /** @returns x with A x = b. */
+    FixedVector<N> solve(FixedVector<N> b) const noexcept {
+        double* x = b.data();
+        for (std::size_t k = 0; k < N; ++k)
+            if (mPivots[k] != k)
+                std::swap(x[k], x[mPivots[k]]);
+        for (std::size_t i = 1; i < N; ++i)
+            for (std::size_t j = 0; j < i; ++j)
+                x[i] -= mLU.row(i)[j] * x[j];
+        for (std::size_t i = N; i-- > 0;) {
+            for (std::size_t j = i + 1; j < N; ++j)
+                x[i] -= mLU.row(i)[j] * x[j];
+            x[i] /= mLU.row(i)[i];
+        }
+        return b;
+    }
+
+    /** det(A) from the diagonal of U and the pivot parity. */
+    double determinant() const noexcept {
+        double det = 1.0;
+        for (std::size_t k = 0; k < N; ++k)
+            det *= mPivots[k] != k ? -mLU.row(k)[k] : mLU.row(k)[k];
+        return det;
+    }
+
+    /** Packed factors: unit-lower L below the diagonal, U on and above it. */
+    const FixedMatrix<N, N>& factors() const noexcept { return mLU; }
+
+private:
+    FixedMatrix<N, N> mLU;
+    std::size_t       mPivots[N];
+};
+
+/**
+ * @brief Cholesky factorization A = L·Lᵀ of a fixed-size SPD matrix.
+ *
+ * Only the lower triangle of A is read. Suited to small normal equations
+ * such as the 7×7 regression system: the whole factor lives on the stack.
+ */
+template <std::size_t N>
+class FixedCholeskyFactorization {
+public:
+    /** @throws std::runtime_error if A is not positive definite. */
+    explicit FixedCholeskyFactorization(const FixedMatrix<N, N>& A) : mL() {
+        for (std::size_t j = 0; j < N; ++j) {
+            double d = A.row(j)[j];
+            for (std::size_t k = 0; k < j; ++k)
+                d -= mL.row(j)[k] * mL.row(j)[k];
+            if (!(d > 0.0))
+                throw std::runtime_error("Matrix is not positive definite");
+            const double ljj = std::sqrt(d);
+            mL.row(j)[j] = ljj;
+            for (std::size_t i = j + 1; i < N; ++i) {
+                double s = A.row(i)[j];
+                for (std::size_t k = 0; k < j; ++k)
+                    s -= mL.row(i)[k] * mL.row(j)[k];
+                mL.row(i)[j] = s / ljj;
+            }
+        }
+    }
+
+    /** @returns x with A x = b. */
+    FixedVector<N> solve(FixedVector<N> b) const noexcept {
+        double* x = b.data();
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t k = 0; k < i; ++k)
+                x[i] -= mL.row(i)[k] * x[k];
+            x[i] /= mL.row(i)[i];
+        }
+        for (std::size_t i = N; i-- > 0;) {
+            for (std::size_t k = i + 1; k < N; ++k)
+                x[i] -= mL.row(k)[i] * x[k];
+            x[i] /= mL.row(i)[i];
+        }
+        return b;
+    }
+
+    /** Lower-triangular factor L (upper triangle is zero). */
+    const FixedMatrix<N, N>& factor() const noexcept { return mL; }
+
+private:
+    FixedMatrix<N, N> mL;
+};
+
+#endif // FIXEDMATRIX_HPP
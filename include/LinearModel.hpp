@@ -0,0 +1,80 @@
+// include/LinearModel.hpp
+#ifndef LINEARMODEL_HPP
+#define LINEARMODEL_HPP
+
+#include <cstddef>
+#include "Matrix.hpp"
+#include "Span.hpp"
+#include "Vector.hpp"
+
+/** Goodness of fit of a model on one batch of rows. */
+struct RegressionMetrics {
+    std::size_t count = 0;    ///< rows scored
+    double      rmse  = 0.0;  ///< root mean squared error
+    double      mae   = 0.0;  ///< mean absolute error
+    double      r2    = 0.0;  ///< coefficient of determination, 1 - SSE/SST
+};
+
+/**
+ * @brief Fitted linear model ŷ = intercept + Σ_j w_j x_j, for serving.
+ *
+ * Feature standardization given at construction is folded into the
+ * weights, so every prediction is a single dot product over the raw row.
+ * Single-row predict() never allocates; batch predict() and evaluate()
+ * stream the rows of a MatrixView, split over threads by fixed row blocks
+ * whose partial metrics are combined in block order, so results do not
+ * depend on the thread count.
+ */
+class LinearModel {
+public:
+    /** Model on raw features: ŷ = intercept + coefficients · x. */
+    explicit LinearModel(const Vector& coefficients, double intercept = 0.0);
+    /**
+     * Model fitted on standardized features:
+     * ŷ = intercept + Σ_j coefficients_j (x_j - means_j) / scales_j.
+     * @throws std::length_error if the vectors differ in length,
+     *         std::invalid_argument if a scale is zero.
+     */
+    LinearModel(const Vector& coefficients, double intercept,
+                const Vector& means, const Vector& scales);
+
+    /** Number of features a row must have. */
+    std::size_t features() const noexcept;
+    /** Weights on the raw features (standardization folded in). */
+    const Vector& weights() const noexcept;
+    /** Constant term on the raw features. */
+    double intercept() const noexcept;
+
+    /** Prediction for one row of features() values; unchecked, no allocation. */
+    double predict(const double* row) const noexcept;
+    /**
+     * Prediction for one row; no allocation.
+     * @throws std::length_error if row.size() != features().
+     */
+    double predict(Span<const double> row) const;
+
+    /**
+     * Predictions for every row of X into a preallocated @p out.
+     * @throws std::length_error on shape mismatch.
+     */
+    void predict(MatrixView X, Span<double> out) const;
+    /** @returns predictions for every row of X. */
+    Vector predict(MatrixView X) const;
+
+    /**
+     * RMSE, MAE and R² of the predictions on (X, y), computed in the same
+     * pass as the predictions without storing them.
+     * @throws std::length_error on shape mismatch,
+     *         std::invalid_argument if X has no rows.
+     */
+    RegressionMetrics evaluate(MatrixView X, Span<const double> y) const;
+    RegressionMetrics evaluate(MatrixView X, const Vector& y) const;
+
+private:
+    void checkBatch(const MatrixView& X, std::size_t outputs) const;
+
+    Vector mWeights;
+    double mIntercept;
+};
+
+#endif // LINEARMODEL_HPP
@@ -0,0 +1,82 @@
+// include/LinearOperator.hpp
+#ifndef LINEAROPERATOR_HPP
+#define LINEAROPERATOR_HPP
+
+#include <cstddef>
+#include <vector>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Abstract linear map y = A·x for matrix-free iterative solvers.
+ *
+ * Implementations only need to know how to apply A; nothing has to be
+ * materialized. Operators referencing other objects do not own them.
+ */
+class LinearOperator {
+public:
+    virtual ~LinearOperator();
+
+    virtual std::size_t rows() const noexcept = 0;
+    virtual std::size_t cols() const noexcept = 0;
+
+    /** y = A·x into a preallocated y of length rows(). */
+    virtual void apply(const Vector& x, Vector& y) const = 0;
+
+    /**
+     * y = Aᵀ·x into a preallocated y of length cols().
+     * @throws std::logic_error unless the operator supports it.
+     */
+    virtual void applyTranspose(const Vector& x, Vector& y) const;
+};
+
+/**
+ * @brief Adapter presenting a dense Matrix as a LinearOperator.
+ *
+ * applyTranspose() keeps its partial sums in an internal buffer, so it
+ * does not allocate after the first call but one instance must not be
+ * applied from several threads at once.
+ */
+class DenseOperator : public LinearOperator {
+public:
+    explicit DenseOperator(const Matrix& A) noexcept;
+
+    std::size_t rows() const noexcept override;
+    std::size_t cols() const noexcept override;
+    void apply(const Vector& x, Vector& y) const override;
+    void applyTranspose(const Vector& x, Vector& y) const override;
+
+private:
+    const Matrix&               mA;
+    mutable std::vector<double> mScratch;
+};
+
+/**
+ * @brief Implicit normal-equation operator (XᵀX + λI)·p = Xᵀ(X·p) + λp.
+ *
+ * Lets CG solve least-squares problems without forming the Gram matrix:
+ * each apply costs one X product and one Xᵀ product. X must support
+ * applyTranspose(). apply() uses an internal buffer, so one instance must
+ * not be applied from several threads at once.
+ */
+class NormalOperator : public LinearOperator {
+public:
+    /** @param ridge  λ ≥ 0 added to the diagonal (Tikhonov regularization). */
+    explicit NormalOperator(const LinearOperator& X, double ridge = 0.0);
+
+    std::size_t rows() const noexcept override;
+    std::size_t cols() const noexcept override;
+    void apply(const Vector& x, Vector& y) const override;
+    /** The operator is symmetric, so this equals apply(). */
+    void applyTranspose(const Vector& x, Vector& y) const override;
+
+    /** b = Xᵀ·y, the matching right-hand side of the normal equations. */
+    Vector rhs(const Vector& y) const;
+
+private:
+    const LinearOperator& mX;
+    double                mRidge;
+    mutable Vector        mXp;
+};
+
+#endif // LINEAROPERATOR_HPP
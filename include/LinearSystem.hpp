@@ -1,11 +1,16 @@
 #ifndef LINEARSYSTEM_HPP
 #define LINEARSYSTEM_HPP
 
+#include "ConjugateGradient.hpp"
+#include "LinearOperator.hpp"
 #include "Matrix.hpp"
 #include "Vector.hpp"
 
 /**
  * @brief Solve Ax = b using Gaussian elimination with pivoting.
+ *
+ * Each Solve() factors A afresh; to reuse the O(n³) work across many
+ * right-hand sides, build an LUFactorization once instead.
  */
 class LinearSystem {
 public:
@@ -16,6 +21,13 @@ public:
     virtual Vector Solve() const;
 
 protected:
+    /** Selects the constructor that only requires A.rows() == b.size(). */
+    struct RectangularTag {};
+    LinearSystem(const Matrix& A, const Vector& b, RectangularTag);
+    /** Selects the constructor for matrix-free systems: mA stays empty. */
+    struct OperatorTag {};
+    LinearSystem(const Vector& b, OperatorTag);
+
     std::size_t mSize;
     Matrix      mA;
     Vector      mb;
@@ -23,11 +35,105 @@ protected:
 
 /**
  * @brief Conjugate-Gradient solver for symmetric positive systems.
+ *
+ * Stopping rules come from CGOptions; an optional preconditioner (not
+ * owned) must outlive the system. A may be a dense Matrix (copied) or any
+ * LinearOperator (referenced, never materialized), e.g. a NormalOperator.
+ * For many solves against the same A, use a ConjugateGradient engine
+ * directly to avoid per-call setup.
  */
 class PosSymLinSystem : public LinearSystem {
 public:
     using LinearSystem::LinearSystem;
+    PosSymLinSystem(const Matrix& A, const Vector& b, const CGOptions& options,
+                    const Preconditioner* preconditioner = nullptr);
+    /** Matrix-free system; @p A must outlive the system. */
+    PosSymLinSystem(const LinearOperator& A, const Vector& b,
+                    const CGOptions& options = CGOptions(),
+                    const Preconditioner* preconditioner = nullptr);
+
+    /** @returns solution vector x, starting from x = 0. */
+    Vector Solve() const override;
+    /** Warm start from the incoming x; x receives the solution. */
+    CGResult Solve(Vector& x) const;
+
+    const CGOptions& options() const noexcept;
+    void setOptions(const CGOptions& options);
+    void setPreconditioner(const Preconditioner* preconditioner) noexcept;
+
+private:
+    CGOptions             mOptions;
+    const Preconditioner* mPreconditioner = nullptr;
+    const LinearOperator* mOperator = nullptr;
+};
+
+/**
+ * @brief Direct solver for symmetric positive-definite systems (A = L·Lᵀ).
+ *
+ * Deterministic n³/3 alternative to PosSymLinSystem for small dense
+ * systems such as regression normal equations. Reads the lower triangle.
+ */
+class CholeskySystem : public LinearSystem {
+public:
+    using LinearSystem::LinearSystem;
+    Vector Solve() const override;
+};
+
+/**
+ * @brief Least-squares solver min ||A x - b||₂ for tall A via Householder QR.
+ *
+ * Works on the design matrix directly instead of forming AᵀA, so the
+ * condition number is not squared. Solve() returns x of length A.cols().
+ */
+class LeastSquaresSystem : public LinearSystem {
+public:
+    /** @throws std::invalid_argument unless A.rows() == b.size() >= A.cols(). */
+    LeastSquaresSystem(const Matrix& A, const Vector& b);
+    Vector Solve() const override;
+};
+
+/** Stopping rule for MixedPrecisionSystem's iterative refinement. */
+struct RefinementOptions {
+    /** Corrections applied before giving up on the float32 factors. */
+    std::size_t maxIterations = 30;
+};
+
+/** Outcome of a MixedPrecisionSystem solve. */
+struct RefinementResult {
+    std::size_t iterations   = 0;      ///< float32 corrections applied
+    double      residualNorm = 0.0;    ///< final ||b - A x||∞
+    bool        converged    = false;  ///< refinement reached double accuracy
+    bool        fellBack     = false;  ///< solved by the double LU instead
+};
+
+/**
+ * @brief Mixed-precision LU solver: factor in float32, refine in double.
+ *
+ * A is rounded to float and factored once (half the memory traffic, twice
+ * the SIMD width of the double LU); each refinement step computes the
+ * residual r = b - A x in double and corrects x with the float32 factors.
+ * Iteration stops once ||r||∞ <= √n · ε · ||A||∞ · ||x||∞, the backward
+ * error a double LU achieves. If A does not fit in float, the float factors
+ * are singular, or refinement stalls (κ(A) beyond roughly 1/ε_float), the
+ * system is re-solved with LUFactorization, so the answer is never worse.
+ */
+class MixedPrecisionSystem : public LinearSystem {
+public:
+    MixedPrecisionSystem(const Matrix& A, const Vector& b,
+                         const RefinementOptions& options = RefinementOptions());
+
+    /** @returns solution vector x. */
     Vector Solve() const override;
+    /** x (resized as needed) receives the solution. */
+    RefinementResult Solve(Vector& x) const;
+
+    const RefinementOptions& options() const noexcept;
+    void setOptions(const RefinementOptions& options);
+
+private:
+    RefinementResult fallBack(Vector& x, std::size_t iterations) const;
+
+    RefinementOptions mOptions;
 };
 
 #endif // LINEARSYSTEM_HPP
@@ -0,0 +1,38 @@
+// include/MappedFile.hpp
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Pages are loaded on demand by the OS, so even files larger than RAM can
+ * be scanned. On platforms without mmap the file is read into a buffer.
+ */
+class MappedFile {
+public:
+    /** @throws std::runtime_error if the file cannot be opened or mapped. */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /** First byte of the file (nullptr for an empty file). */
+    const char* data() const noexcept;
+    std::size_t size() const noexcept;
+
+private:
+    void release() noexcept;
+
+    const char*       mData;
+    std::size_t       mSize;
+    std::vector<char> mFallback;   // used only without mmap support
+};
+
+#endif // MAPPEDFILE_HPP
@@ -2,46 +2,330 @@
 #define MATRIX_HPP
 
 #include <cstddef>
+#include <functional>
 #include <stdexcept>
+#include <vector>
+#include "Expression.hpp"
+#include "Span.hpp"
+#include "Vector.hpp"
 
 /**
- * @brief Dynamic 2-D matrix with heap storage.
+ * @brief Dynamic 2-D matrix backed by one contiguous, row-major buffer.
+ *
+ * Element (i,j) lives at data()[(i-1)*stride() + (j-1)]; the buffer is
+ * aligned to Matrix::kAlignment bytes so kernels can stream it linearly.
+ * +, - and scalar * build lazy expressions (see Expression.hpp) that are
+ * evaluated in a single pass, threaded by row blocks, on assignment.
+ * Storage comes from the thread's currentResource() (see MemoryResource.hpp).
  */
 class Matrix {
 public:
+    /** Byte alignment of the backing buffer. */
+    static constexpr std::size_t kAlignment = MemoryResource::kDefaultAlignment;
+    /** Element-wise kernels hand each thread about this many elements. */
+    static constexpr std::size_t kElementGrain = std::size_t(1) << 15;
+    /**
+     * Rows per parallel block for rows of @p cols elements: about
+     * kElementGrain elements, at least one row. Depends only on the shape,
+     * so blocked reductions split (and sum) the same way every run.
+     */
+    static std::size_t rowGrain(std::size_t cols) noexcept;
+
     /** Create rows×cols zeroed matrix. */
     Matrix(std::size_t rows, std::size_t cols);
-    /** Deep-copy constructor. */
+    /** Deep-copy constructor (single allocation + copy). */
     Matrix(const Matrix& other);
-    /** Copy assignment. */
+    /** Move constructor; steals storage, leaves @p other empty. */
+    Matrix(Matrix&& other) noexcept;
+    /** Copy assignment; reuses the buffer when shapes match. */
     Matrix& operator=(const Matrix& other);
+    /**
+     * Move assignment; steals storage when both use the same resource,
+     * otherwise copies into this matrix's own resource (as std::pmr does).
+     */
+    Matrix& operator=(Matrix&& other);
     /** Free heap storage. */
     ~Matrix();
 
+    /** Evaluate an element-wise expression in one fused pass. */
+    template <typename Node>
+    Matrix(const MatrixExpression<Node>& e);
+    /** Assign an expression; evaluated in place, so it may refer to this matrix. */
+    template <typename Node>
+    Matrix& operator=(const MatrixExpression<Node>& e);
+
     /** 1-based bounds-checked element access. */
     double& operator()(std::size_t i, std::size_t j);
     const double& operator()(std::size_t i, std::size_t j) const;
 
-    /** Matrix addition. */
-    Matrix operator+(const Matrix& rhs) const;
     /** Matrix×Matrix multiplication. */
     Matrix operator*(const Matrix& rhs) const;
-    /** Scalar multiplication. */
-    Matrix operator*(double scalar) const;
+    /** Matrix×Vector multiplication. */
+    Vector operator*(const Vector& x) const;
+
+    /** In-place addition. */
+    Matrix& operator+=(const Matrix& rhs);
+    /** In-place subtraction. */
+    Matrix& operator-=(const Matrix& rhs);
+    /** In-place addition of an expression, fused. */
+    template <typename Node>
+    Matrix& operator+=(const MatrixExpression<Node>& e);
+    /** In-place subtraction of an expression, fused. */
+    template <typename Node>
+    Matrix& operator-=(const MatrixExpression<Node>& e);
+    /** In-place scaling. */
+    Matrix& operator*=(double scalar);
 
-    /** Determinant (square only). */
+    /** out = this × rhs into a preallocated rows()×rhs.cols() matrix. */
+    void multiply(const Matrix& rhs, Matrix& out) const;
+    /** y = this × x into a preallocated vector of length rows(). */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /** y = thisᵀ × x into a preallocated vector of length cols(). */
+    void transposeMultiply(const Vector& x, Vector& y) const;
+    /**
+     * As above, with the per-thread partial sums of tall matrices kept in
+     * @p scratch, which only ever grows: repeated calls (an iterative
+     * solver's inner loop) do not allocate once it has reached its size.
+     */
+    void transposeMultiply(const Vector& x, Vector& y, std::vector<double>& scratch) const;
+
+    /**
+     * Determinant (square only), via LU; 0 if A is numerically singular.
+     * To reuse an existing factorization call LUFactorization::determinant().
+     */
     double determinant() const;
-    /** Inverse (square only). */
+    /**
+     * Inverse (square only), via LU.
+     * @throws std::runtime_error if the matrix is singular.
+     * To reuse an existing factorization call LUFactorization::inverse().
+     */
     Matrix inverse() const;
-    /** Moore–Penrose pseudo-inverse. */
+    /** Moore–Penrose pseudo-inverse via SVD, default rank tolerance. */
     Matrix pseudoInverse() const;
+    /** Pseudo-inverse dropping singular values <= @p tol (see SVDFactorization). */
+    Matrix pseudoInverse(double tol) const;
+
+    std::size_t rows() const noexcept;
+    std::size_t cols() const noexcept;
+    /** Leading dimension: element distance between consecutive rows. */
+    std::size_t stride() const noexcept;
+    /** Resource the buffer was allocated from. */
+    MemoryResource* resource() const noexcept;
+
+    /** Raw pointer to the row-major buffer. */
+    double*       data() noexcept;
+    const double* data() const noexcept;
+
+    /** Raw pointer to 0-based row @p i (unchecked). */
+    double*       row(std::size_t i) noexcept;
+    const double* row(std::size_t i) const noexcept;
+
+    /** Unchecked view of 0-based row @p i. */
+    Span<double>       rowView(std::size_t i) noexcept;
+    Span<const double> rowView(std::size_t i) const noexcept;
+    /** Unchecked strided view of 0-based column @p j. */
+    StridedSpan<double>       colView(std::size_t j) noexcept;
+    StridedSpan<const double> colView(std::size_t j) const noexcept;
+
+    /** Iterate all elements in row-major order (storage is dense). */
+    double*       begin() noexcept;
+    const double* begin() const noexcept;
+    double*       end() noexcept;
+    const double* end() const noexcept;
+
+private:
+    struct Uninitialized {};
+    /** rows×cols matrix whose elements are left unset. */
+    Matrix(std::size_t rows, std::size_t cols, Uninitialized);
+
+    /** Run fn over row blocks of this matrix, spread over the thread pool. */
+    void forRowBlocks(const std::function<void(std::size_t, std::size_t)>& fn) const;
+    /** store(element, value) for every element of e, split by rows when large. */
+    template <typename Node, typename Store>
+    void evaluate(const MatrixExpression<Node>& e, Store store);
+
+    std::size_t     mRows, mCols, mStride;
+    MemoryResource* mResource;
+    double*         mData;
+};
+
+/**
+ * @brief Read-only, non-owning view of a row-major matrix.
+ *
+ * Same layout contract as Matrix (element (i,j) at data()[(i-1)*stride() +
+ * (j-1)]), so it can wrap a Matrix or memory that lives elsewhere, such as
+ * a memory-mapped file, without copying. The view does not keep its
+ * storage alive.
+ */
+class MatrixView {
+public:
+    MatrixView() noexcept;
+    MatrixView(const double* data, std::size_t rows, std::size_t cols,
+               std::size_t stride) noexcept;
+    /** View of a whole Matrix. */
+    MatrixView(const Matrix& m) noexcept;
+
+    /** 1-based bounds-checked element access. */
+    const double& operator()(std::size_t i, std::size_t j) const;
 
     std::size_t rows() const noexcept;
     std::size_t cols() const noexcept;
+    std::size_t stride() const noexcept;
+    const double* data() const noexcept;
+    /** Raw pointer to 0-based row @p i (unchecked). */
+    const double* row(std::size_t i) const noexcept;
+    Span<const double>        rowView(std::size_t i) const noexcept;
+    StridedSpan<const double> colView(std::size_t j) const noexcept;
+
+    /** Deep copy into an owning Matrix. */
+    Matrix toMatrix() const;
 
 private:
-    std::size_t mRows, mCols;
-    double**    mData;
+    const double* mData;
+    std::size_t   mRows, mCols, mStride;
 };
 
+// Accessors are inline so hot loops see through them; operator() stays checked.
+inline double& Matrix::operator()(std::size_t i, std::size_t j) {
+    if (i == 0 || i > mRows || j == 0 || j > mCols)
+        throw std::out_of_range("Matrix 1-based index out of range");
+    return mData[(i - 1) * mStride + (j - 1)];
+}
+
+inline const double& Matrix::operator()(std::size_t i, std::size_t j) const {
+    if (i == 0 || i > mRows || j == 0 || j > mCols)
+        throw std::out_of_range("Matrix 1-based index out of range");
+    return mData[(i - 1) * mStride + (j - 1)];
+}
+
+inline std::size_t Matrix::rows() const noexcept { return mRows; }
+inline std::size_t Matrix::cols() const noexcept { return mCols; }
+inline std::size_t Matrix::stride() const noexcept { return mStride; }
+
+inline double*       Matrix::data() noexcept       { return mData; }
+inline const double* Matrix::data() const noexcept { return mData; }
+
+inline double*       Matrix::row(std::size_t i) noexcept       { return mData + i * mStride; }
+inline const double* Matrix::row(std::size_t i) const noexcept { return mData + i * mStride; }
+
+inline Span<double> Matrix::rowView(std::size_t i) noexcept {
+    return Span<double>(row(i), mCols);
+}
+inline Span<const double> Matrix::rowView(std::size_t i) const noexcept {
+    return Span<const double>(row(i), mCols);
+}
+inline StridedSpan<double> Matrix::colView(std::size_t j) noexcept {
+    return StridedSpan<double>(mData + j, mRows, mStride);
+}
+inline StridedSpan<const double> Matrix::colView(std::size_t j) const noexcept {
+    return StridedSpan<const double>(mData + j, mRows, mStride);
+}
+
+inline double*       Matrix::begin() noexcept       { return mData; }
+inline const double* Matrix::begin() const noexcept { return mData; }
+inline double*       Matrix::end() noexcept         { return mData + mRows * mStride; }
+inline const double* Matrix::end() const noexcept   { return mData + mRows * mStride; }
+
+template <typename Node>
+Matrix::Matrix(const MatrixExpression<Node>& e)
+    : Matrix(e.rows(), e.cols(), Uninitialized{})
+{
+    evaluate(e, [](double& c, double v) { c = v; });
+}
+
+template <typename Node>
+Matrix& Matrix::operator=(const MatrixExpression<Node>& e) {
+    // Operand shapes are checked on construction, so an expression of a
+    // different shape cannot refer to this matrix.
+    if (e.rows() != mRows || e.cols() != mCols)
+        return *this = Matrix(e);
+    evaluate(e, [](double& c, double v) { c = v; });
+    return *this;
+}
+
+template <typename Node>
+Matrix& Matrix::operator+=(const MatrixExpression<Node>& e) {
+    if (e.rows() != mRows || e.cols() != mCols)
+        throw std::length_error("Matrix size mismatch");
+    evaluate(e, [](double& c, double v) { c += v; });
+    return *this;
+}
+
+template <typename Node>
+Matrix& Matrix::operator-=(const MatrixExpression<Node>& e) {
+    if (e.rows() != mRows || e.cols() != mCols)
+        throw std::length_error("Matrix size mismatch");
+    evaluate(e, [](double& c, double v) { c -= v; });
+    return *this;
+}
+
+template <typename Node, typename Store>
+void Matrix::evaluate(const MatrixExpression<Node>& e, Store store) {
+    auto body = [this, &e, store](std::size_t r0, std::size_t r1) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            double* c = row(i);
+            for (std::size_t j = 0; j < mCols; ++j)
+                store(c[j], e.coeff(i, j));
+        }
+    };
+    // Small matrices skip the type-erased pool call entirely.
+    if (mRows * mCols <= kElementGrain)
+        body(0, mRows);
+    else
+        forRowBlocks(body);
+}
+
+template <typename Node>
+Matrix MatrixExpression<Node>::eval() const {
+    return Matrix(*this);
+}
+
+namespace expr {
+inline const Matrix& evaluated(const Matrix& m) noexcept { return m; }
+template <typename Node>
+Matrix evaluated(const MatrixExpression<Node>& e) { return Matrix(e); }
+} // namespace expr
+
+/** Matrix product with an element-wise expression operand, evaluated first. */
+template <typename L, typename R,
+          std::enable_if_t<expr::isMatrixOperand<L> && expr::isMatrixOperand<R> &&
+                           (expr::IsMatrixExpression<L>::value ||
+                            expr::IsMatrixExpression<R>::value), int> = 0>
+Matrix operator*(const L& l, const R& r) {
+    return expr::evaluated(l) * expr::evaluated(r);
+}
+
+/** Matrix expression × vector (or vector expression), evaluated first. */
+template <typename Node, typename V, std::enable_if_t<expr::isVectorOperand<V>, int> = 0>
+Vector operator*(const MatrixExpression<Node>& A, const V& x) {
+    return Matrix(A) * x;
+}
+
+inline MatrixView::MatrixView() noexcept
+    : mData(nullptr), mRows(0), mCols(0), mStride(0) {}
+inline MatrixView::MatrixView(const double* data, std::size_t rows, std::size_t cols,
+                              std::size_t stride) noexcept
+    : mData(data), mRows(rows), mCols(cols), mStride(stride) {}
+inline MatrixView::MatrixView(const Matrix& m) noexcept
+    : mData(m.data()), mRows(m.rows()), mCols(m.cols()), mStride(m.stride()) {}
+
+inline const double& MatrixView::operator()(std::size_t i, std::size_t j) const {
+    if (i == 0 || i > mRows || j == 0 || j > mCols)
+        throw std::out_of_range("Matrix 1-based index out of range");
+    return mData[(i - 1) * mStride + (j - 1)];
+}
+
+inline std::size_t MatrixView::rows() const noexcept { return mRows; }
+inline std::size_t MatrixView::cols() const noexcept { return mCols; }
+inline std::size_t MatrixView::stride() const noexcept { return mStride; }
+inline const double* MatrixView::data() const noexcept { return mData; }
+inline const double* MatrixView::row(std::size_t i) const noexcept { return mData + i * mStride; }
+inline Span<const double> MatrixView::rowView(std::size_t i) const noexcept {
+    return Span<const double>(row(i), mCols);
+}
+inline StridedSpan<const double> MatrixView::colView(std::size_t j) const noexcept {
+    return StridedSpan<const double>(mData + j, mRows, mStride);
+}
+
 #endif // MATRIX_HPP
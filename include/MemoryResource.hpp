@@ -0,0 +1,185 @@
+// include/MemoryResource.hpp
+#ifndef MEMORYRESOURCE_HPP
+#define MEMORYRESOURCE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Polymorphic source of raw memory for Matrix, Vector and BasicMatrix.
+ *
+ * Modelled on std::pmr::memory_resource. Containers allocate from the
+ * calling thread's currentResource() when they are created or copied and
+ * remember that resource, so the buffer is always returned to it. Move
+ * construction carries the resource along with the buffer; assignment
+ * keeps the destination's resource, so move assignment steals the buffer
+ * only when both sides share a resource and copies otherwise.
+ */
+class MemoryResource {
+public:
+    /** Alignment used by the containers (one cache line). */
+    static constexpr std::size_t kDefaultAlignment = 64;
+
+    virtual ~MemoryResource();
+
+    /** @p bytes of storage aligned to @p alignment (a power of two). */
+    void* allocate(std::size_t bytes, std::size_t alignment = kDefaultAlignment) {
+        return doAllocate(bytes, alignment);
+    }
+    /** Return storage obtained from allocate() with the same size and alignment. */
+    void deallocate(void* p, std::size_t bytes,
+                    std::size_t alignment = kDefaultAlignment) noexcept {
+        doDeallocate(p, bytes, alignment);
+    }
+
+protected:
+    virtual void* doAllocate(std::size_t bytes, std::size_t alignment) = 0;
+    virtual void  doDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept = 0;
+};
+
+/** Process-wide resource backed by aligned ::operator new / delete. */
+MemoryResource* newDeleteResource() noexcept;
+
+/** Resource new containers on this thread allocate from (newDeleteResource() by default). */
+MemoryResource* currentResource() noexcept;
+
+/**
+ * Make @p resource (null: newDeleteResource()) the current resource of the
+ * calling thread only. @returns the previous one. Prefer ScopedResource.
+ */
+MemoryResource* setCurrentResource(MemoryResource* resource) noexcept;
+
+/**
+ * @brief Monotonic bump allocator: deallocate() is a no-op and reset()
+ *        frees everything at once.
+ *
+ * Memory comes from @p upstream in blocks of at least blockBytes; a request
+ * larger than that gets a block of its own. reset() rewinds into the
+ * blocks already held, so a workload that repeats (one request, one
+ * prediction) stops touching upstream after the first round. Not
+ * thread-safe: use one arena per thread.
+ */
+class ArenaResource : public MemoryResource {
+public:
+    static constexpr std::size_t kDefaultBlockBytes = std::size_t(1) << 16;
+
+    explicit ArenaResource(std::size_t blockBytes = kDefaultBlockBytes,
+                           MemoryResource* upstream = newDeleteResource());
+    /** Returns every block to upstream. */
+    ~ArenaResource() override;
+
+    ArenaResource(const ArenaResource&) = delete;
+    ArenaResource& operator=(const ArenaResource&) = delete;
+
+    /** Invalidate all allocations and rewind, keeping the blocks for reuse. */
+    void reset() noexcept;
+    /** Invalidate all allocations and return every block to upstream. */
+    void release() noexcept;
+
+    /** Bytes handed out (including alignment padding) since the last reset. */
+    std::size_t bytesUsed() const noexcept;
+    /** Bytes held from upstream. */
+    std::size_t capacity() const noexcept;
+
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override;
+    void  doDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept override;
+
+private:
+    struct Block {
+        unsigned char* data;
+        std::size_t    size;
+    };
+
+    MemoryResource*    mUpstream;
+    std::size_t        mBlockBytes;
+    std::vector<Block> mBlocks;
+    std::size_t        mCurrent = 0;  // block being carved
+    std::size_t        mOffset  = 0;  // bytes used in mBlocks[mCurrent]
+    std::size_t        mUsed    = 0;
+};
+
+/**
+ * @brief Size-class pool: freed buffers are cached per power-of-two class
+ *        and handed out again without touching upstream.
+ *
+ * Requests up to kMaxPooledBytes are rounded up to the next class; larger
+ * ones, or ones needing more than kDefaultAlignment, go straight to
+ * upstream. Unlike an arena, buffers are reusable individually, which
+ * suits long-lived threads that keep allocating same-sized temporaries.
+ * Not thread-safe: use one pool per thread.
+ */
+class PoolResource : public MemoryResource {
+public:
+    static constexpr std::size_t kMinPooledBytes = 64;
+    static constexpr std::size_t kMaxPooledBytes = std::size_t(1) << 20;
+
+    explicit PoolResource(MemoryResource* upstream = newDeleteResource());
+    /** Returns cached buffers to upstream; buffers still in use must not outlive the pool. */
+    ~PoolResource() override;
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    /** Return every cached (currently free) buffer to upstream. */
+    void release() noexcept;
+    /** Number of cached buffers ready for reuse. */
+    std::size_t cachedBuffers() const noexcept;
+
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override;
+    void  doDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept override;
+
+private:
+    MemoryResource*                 mUpstream;
+    std::vector<std::vector<void*>> mFree;  // one free list per size class
+    std::vector<std::size_t>        mLive;  // buffers per class held from upstream
+};
+
+/**
+ * @brief Installs a resource as the calling thread's current resource for
+ *        the lifetime of the scope, then restores the previous one.
+ */
+class ScopedResource {
+public:
+    explicit ScopedResource(MemoryResource& resource) noexcept;
+    ~ScopedResource();
+
+    ScopedResource(const ScopedResource&) = delete;
+    ScopedResource& operator=(const ScopedResource&) = delete;
+
+private:
+    MemoryResource* mPrevious;
+};
+
+/**
+ * @brief Routes this thread's Matrix / Vector allocations into an arena for
+ *        the scope and frees them all at once when it ends.
+ *
+ * Containers created inside the scope must not outlive it. To keep a
+ * result, assign it to a container created outside the scope, e.g.
+ * `x = solver.Solve();`: assignment copies into the destination's own
+ * resource. Pass a long-lived ArenaResource to keep its blocks across
+ * scopes; it is reset, not released, on exit.
+ */
+class ScopedArena {
+public:
+    /** Use a private arena, released on exit. */
+    explicit ScopedArena(std::size_t blockBytes = ArenaResource::kDefaultBlockBytes);
+    /** Use @p arena, reset on exit. */
+    explicit ScopedArena(ArenaResource& arena) noexcept;
+    ~ScopedArena();
+
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+
+    ArenaResource& arena() noexcept { return *mArena; }
+
+private:
+    std::unique_ptr<ArenaResource> mOwned;  // null when borrowing
+    ArenaResource*                 mArena;
+    MemoryResource*                mPrevious;
+};
+
+#endif // MEMORYRESOURCE_HPP
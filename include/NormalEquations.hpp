@@ -0,0 +1,68 @@
+// include/NormalEquations.hpp
+#ifndef NORMALEQUATIONS_HPP
+#define NORMALEQUATIONS_HPP
+
+#include <cstddef>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Streaming accumulator for the least-squares normal equations.
+ *
+ * Rows are folded in chunk by chunk (via the fused gram kernel) and can be
+ * discarded afterwards: memory stays O(p²) however many rows are seen.
+ * Besides XᵀX and Xᵀy it keeps yᵀy, so the residual sum of squares of any
+ * coefficient vector over the accumulated rows is available without a
+ * second pass.
+ */
+class NormalEquationAccumulator {
+public:
+    /** Empty accumulator for rows with @p features columns. */
+    explicit NormalEquationAccumulator(std::size_t features);
+
+    std::size_t features() const noexcept;
+    /** Number of rows accumulated so far. */
+    std::size_t count() const noexcept;
+
+    /** Add the rows of X (rows × features) with targets y. */
+    void add(const Matrix& X, const Vector& y);
+    /** Add @p m rows of a row-major buffer with leading dimension @p ldx. */
+    void add(std::size_t m, const double* X, std::size_t ldx, const double* y);
+    /** Add a single row. */
+    void addRow(const double* x, double y);
+    /** Fold in the rows of another accumulator (e.g. another shard). */
+    void merge(const NormalEquationAccumulator& other);
+    /**
+     * Remove the rows of @p other, which must have been folded in before
+     * (e.g. the held-out fold of a cross-validation split).
+     * @throws std::invalid_argument if @p other holds more rows than this.
+     */
+    void subtract(const NormalEquationAccumulator& other);
+    /** Forget all rows. */
+    void reset();
+
+    /** XᵀX (full symmetric). */
+    const Matrix& gram() const noexcept;
+    /** Xᵀy. */
+    const Vector& rhs() const noexcept;
+    /** yᵀy. */
+    double sumSquares() const noexcept;
+
+    /**
+     * Coefficients minimising ||Xβ - y||² + ridge·||β||² via Cholesky.
+     * @throws std::runtime_error if XᵀX + ridge·I is not positive definite.
+     */
+    Vector solve(double ridge = 0.0) const;
+
+    /** ||Xβ - y||² over the accumulated rows, as yᵀy - 2βᵀXᵀy + βᵀXᵀXβ. */
+    double residualSumOfSquares(const Vector& beta) const;
+
+private:
+    std::size_t mFeatures;
+    std::size_t mCount;
+    Matrix      mGram;
+    Vector      mRhs;
+    double      mSumSquares;
+};
+
+#endif // NORMALEQUATIONS_HPP
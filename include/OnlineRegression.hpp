@@ -0,0 +1,74 @@
+// include/OnlineRegression.hpp
+#ifndef ONLINEREGRESSION_HPP
+#define ONLINEREGRESSION_HPP
+
+#include <cstddef>
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Recursive least-squares model updated one observation at a time.
+ *
+ * Keeps the upper-triangular factor R of (λ·I + Σ wᵢ xᵢxᵢᵀ) = RᵀR and the
+ * weighted Xᵀy. add() folds a row into R with Givens rotations and remove()
+ * takes one out with hyperbolic rotations, both in O(p²); no refit from
+ * scratch is ever needed. With a forgetting factor f < 1, every add() first
+ * scales the existing information by f, so old rows (and the ridge prior)
+ * fade geometrically.
+ *
+ * Coefficients are solved lazily, in O(p²), the first time they are asked
+ * for after a change.
+ */
+class OnlineRegression {
+public:
+    /**
+     * @param features    number of coefficients p.
+     * @param ridge       λ ≥ 0; a positive value makes the model solvable
+     *                    before p independent rows have arrived.
+     * @param forgetting  f in (0, 1]; 1 keeps every row at full weight.
+     * @throws std::invalid_argument for out-of-range parameters.
+     */
+    explicit OnlineRegression(std::size_t features, double ridge = 0.0,
+                              double forgetting = 1.0);
+
+    std::size_t features() const noexcept;
+    /** Rows added minus rows removed. */
+    std::size_t count() const noexcept;
+    double      forgetting() const noexcept;
+
+    /** Add one observation (x has features() entries). */
+    void add(const double* x, double y);
+    void add(const Vector& x, double y);
+    /** Add every row of a mini-batch in order. */
+    void add(const Matrix& X, const Vector& y);
+
+    /**
+     * Remove a previously added observation at unit weight (e.g. the row
+     * leaving a sliding window).
+     * @throws std::runtime_error if the downdated system would no longer be
+     *         positive definite; the model is left unchanged.
+     */
+    void remove(const double* x, double y);
+    void remove(const Vector& x, double y);
+
+    /**
+     * Current least-squares coefficients.
+     * @throws std::runtime_error while the system is still singular.
+     */
+    const Vector& coefficients() const;
+
+    /** Upper-triangular factor R with RᵀR = λ·I + Σ wᵢ xᵢxᵢᵀ. */
+    const Matrix& factor() const noexcept;
+
+private:
+    std::size_t    mFeatures;
+    std::size_t    mCount;
+    double         mForgetting;
+    Matrix         mR;
+    Vector         mXty;
+    Vector         mWork;
+    mutable Vector mBeta;
+    mutable bool   mDirty;
+};
+
+#endif // ONLINEREGRESSION_HPP
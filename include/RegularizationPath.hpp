@@ -0,0 +1,119 @@
+// include/RegularizationPath.hpp
+#ifndef REGULARIZATIONPATH_HPP
+#define REGULARIZATIONPATH_HPP
+
+#include <cstddef>
+#include <vector>
+#include "Matrix.hpp"
+#include "NormalEquations.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Ridge solutions β(λ) = (XᵀX + λI)⁻¹Xᵀy for any number of λ.
+ *
+ * XᵀX = V·diag(s)·Vᵀ is decomposed once (via SVDFactorization of the
+ * symmetric Gram matrix) and z = VᵀXᵀy is kept, so each λ afterwards costs
+ * one O(p²) product β = V·(z / (s + λ)) instead of a fresh factorization.
+ * Every coefficient is penalized, including an intercept column.
+ */
+class RidgePath {
+public:
+    /**
+     * Decompose a symmetric positive semi-definite @p gram (XᵀX) with
+     * right-hand side @p rhs (Xᵀy).
+     * @throws std::invalid_argument if gram is not square,
+     *         std::length_error if rhs has the wrong size.
+     */
+    RidgePath(const Matrix& gram, const Vector& rhs);
+    /** Path for the rows folded into @p normal. */
+    explicit RidgePath(const NormalEquationAccumulator& normal);
+
+    std::size_t features() const noexcept;
+    /** Eigenvalues of XᵀX, descending. */
+    const Vector& eigenvalues() const noexcept;
+
+    /**
+     * Coefficients for one λ.
+     * @throws std::invalid_argument if lambda < 0,
+     *         std::runtime_error if XᵀX + λI is numerically singular.
+     */
+    Vector solve(double lambda) const;
+    /** Coefficients for every λ, row l holding β(lambdas[l]); λs run in parallel. */
+    Matrix path(const std::vector<double>& lambdas) const;
+    /** Effective degrees of freedom Σ s / (s + λ). */
+    double degreesOfFreedom(double lambda) const;
+
+private:
+    void coefficients(double lambda, double* beta) const;
+
+    Matrix mV;
+    Vector mEigen;
+    Vector mZ;
+    double mTolerance;
+};
+
+/** Settings for ElasticNetPath. */
+struct ElasticNetOptions {
+    /** Mix between lasso (1) and ridge (0) penalties. */
+    double alpha = 1.0;
+    /** Stop once max_j G_jj·Δβ_j² < tolerance · yᵀy over a sweep. */
+    double tolerance = 1e-10;
+    /** Coordinate sweeps per λ before giving up. */
+    std::size_t maxSweeps = 100000;
+    /** Per-coefficient penalty weights (empty: all 1; 0 leaves e.g. an intercept unpenalized). */
+    std::vector<double> penaltyFactors;
+};
+
+/** One point of an elastic-net path. */
+struct ElasticNetFit {
+    double      lambda = 0.0;
+    Vector      coefficients{0};
+    std::size_t sweeps = 0;
+    bool        converged = false;
+};
+
+/**
+ * @brief Elastic-net path by cyclic coordinate descent on the normal equations.
+ *
+ * Minimises ½||y - Xβ||² + λ·Σ_j w_j (α|β_j| + ½(1-α)β_j²), the same λ
+ * scale as RidgePath (α = 0 reproduces it when all weights are 1). Updates
+ * use XᵀX and Xᵀy only, so a sweep is O(p²) whatever the row count, and
+ * each λ of a path starts from the previous solution.
+ */
+class ElasticNetPath {
+public:
+    /**
+     * @throws std::invalid_argument if alpha is outside [0, 1] or a
+     *         penalty factor is negative, std::length_error if
+     *         penaltyFactors has the wrong size.
+     */
+    explicit ElasticNetPath(const NormalEquationAccumulator& normal,
+                            ElasticNetOptions options = {});
+
+    std::size_t features() const noexcept;
+    const ElasticNetOptions& options() const noexcept;
+
+    /**
+     * Smallest λ at which every penalized coefficient is zero (unpenalized
+     * ones then take their least-squares values); infinity when alpha == 0.
+     * @throws std::runtime_error if the unpenalized block of XᵀX is singular.
+     */
+    double lambdaMax() const;
+    /** @p count λs spaced geometrically from lambdaMax() down to ratio·lambdaMax(). */
+    std::vector<double> lambdaGrid(std::size_t count, double ratio = 1e-3) const;
+
+    /** Fit one λ starting from @p start (warm start). */
+    ElasticNetFit fit(double lambda, const Vector& start) const;
+    /** Fit one λ from zero. */
+    ElasticNetFit fit(double lambda) const;
+    /** Fit each λ in turn, warm-starting from the previous fit (pass λs decreasing). */
+    std::vector<ElasticNetFit> path(const std::vector<double>& lambdas) const;
+
+private:
+    Matrix            mGram;
+    Vector            mRhs;
+    double            mSumSquares;
+    ElasticNetOptions mOptions;
+};
+
+#endif // REGULARIZATIONPATH_HPP
@@ -0,0 +1,104 @@
+// include/Span.hpp
+#ifndef SPAN_HPP
+#define SPAN_HPP
+
+#include <cstddef>
+#include <iterator>
+
+/**
+ * @brief Non-owning view of a contiguous range (a C++17 stand-in for std::span).
+ *
+ * Element access is unchecked; the view does not keep its storage alive.
+ */
+template <typename T>
+class Span {
+public:
+    using value_type = T;
+    using iterator   = T*;
+
+    Span() noexcept : mData(nullptr), mSize(0) {}
+    Span(T* data, std::size_t size) noexcept : mData(data), mSize(size) {}
+
+    /** 0-based unchecked access. */
+    T& operator[](std::size_t idx) const noexcept { return mData[idx]; }
+
+    T*          data() const noexcept  { return mData; }
+    std::size_t size() const noexcept  { return mSize; }
+    bool        empty() const noexcept { return mSize == 0; }
+    iterator    begin() const noexcept { return mData; }
+    iterator    end() const noexcept   { return mData + mSize; }
+
+private:
+    T*          mData;
+    std::size_t mSize;
+};
+
+/**
+ * @brief Non-owning view of equally spaced elements, e.g. a matrix column.
+ *
+ * Element access is unchecked; the view does not keep its storage alive.
+ */
+template <typename T>
+class StridedSpan {
+public:
+    /** Random-access iterator that advances by the span's stride. */
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        iterator() noexcept : mPtr(nullptr), mStride(1) {}
+        iterator(T* ptr, std::ptrdiff_t stride) noexcept : mPtr(ptr), mStride(stride) {}
+
+        reference operator*() const noexcept { return *mPtr; }
+        pointer   operator->() const noexcept { return mPtr; }
+        reference operator[](difference_type n) const noexcept { return mPtr[n * mStride]; }
+
+        iterator& operator++() noexcept { mPtr += mStride; return *this; }
+        iterator  operator++(int) noexcept { iterator t(*this); mPtr += mStride; return t; }
+        iterator& operator--() noexcept { mPtr -= mStride; return *this; }
+        iterator  operator--(int) noexcept { iterator t(*this); mPtr -= mStride; return t; }
+        iterator& operator+=(difference_type n) noexcept { mPtr += n * mStride; return *this; }
+        iterator& operator-=(difference_type n) noexcept { mPtr -= n * mStride; return *this; }
+        iterator  operator+(difference_type n) const noexcept { return iterator(mPtr + n * mStride, mStride); }
+        iterator  operator-(difference_type n) const noexcept { return iterator(mPtr - n * mStride, mStride); }
+        difference_type operator-(const iterator& o) const noexcept { return (mPtr - o.mPtr) / mStride; }
+
+        bool operator==(const iterator& o) const noexcept { return mPtr == o.mPtr; }
+        bool operator!=(const iterator& o) const noexcept { return mPtr != o.mPtr; }
+        bool operator<(const iterator& o) const noexcept  { return (o - *this) > 0; }
+        bool operator>(const iterator& o) const noexcept  { return o < *this; }
+        bool operator<=(const iterator& o) const noexcept { return !(o < *this); }
+        bool operator>=(const iterator& o) const noexcept { return !(*this < o); }
+
+    private:
+        T*             mPtr;
+        std::ptrdiff_t mStride;
+    };
+
+    StridedSpan() noexcept : mData(nullptr), mSize(0), mStride(1) {}
+    StridedSpan(T* data, std::size_t size, std::size_t stride) noexcept
+        : mData(data), mSize(size), mStride(stride) {}
+
+    /** 0-based unchecked access. */
+    T& operator[](std::size_t idx) const noexcept { return mData[idx * mStride]; }
+
+    T*          data() const noexcept   { return mData; }
+    std::size_t size() const noexcept   { return mSize; }
+    std::size_t stride() const noexcept { return mStride; }
+    bool        empty() const noexcept  { return mSize == 0; }
+    iterator    begin() const noexcept
+    { return iterator(mData, static_cast<std::ptrdiff_t>(mStride)); }
+    iterator    end() const noexcept
+    { return iterator(mData + mSize * mStride, static_cast<std::ptrdiff_t>(mStride)); }
+
+private:
+    T*          mData;
+    std::size_t mSize;
+    std::size_t mStride;
+};
+
+#endif // SPAN_HPP
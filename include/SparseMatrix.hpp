@@ -0,0 +1,115 @@
+// include/SparseMatrix.hpp
+#ifndef SPARSEMATRIX_HPP
+#define SPARSEMATRIX_HPP
+
+#include <cstddef>
+#include <vector>
+#include "LinearOperator.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/** One (row, col, value) entry of a coordinate-format matrix; 0-based. */
+struct Triplet {
+    std::size_t row;
+    std::size_t col;
+    double      value;
+};
+
+/**
+ * @brief Compressed sparse matrix in CSR (row-major) or CSC (column-major) form.
+ *
+ * Storage is the usual outer-pointer / inner-index / value triple: for CSR
+ * the outer dimension is rows, for CSC it is columns. Inner indices are
+ * sorted and unique within each outer slice.
+ *
+ * Products that gather along the stored direction (A·x for CSR, Aᵀ·x for
+ * CSC) run in parallel over outer slices. The scatter-direction products
+ * run in parallel too when per-block partial sums take no more memory than
+ * the nonzeros, and serially otherwise; keep the layout whose gather
+ * matches the hot product.
+ */
+class SparseMatrix {
+public:
+    enum class Format { CSR, CSC };
+
+    /**
+     * Build a rows×cols matrix from COO triplets in any order; duplicate
+     * coordinates are summed.
+     * @throws std::out_of_range if a triplet lies outside the matrix.
+     */
+    SparseMatrix(std::size_t rows, std::size_t cols,
+                 const std::vector<Triplet>& triplets, Format format = Format::CSR);
+    /** Compress the nonzeros of a dense matrix. */
+    explicit SparseMatrix(const Matrix& dense, Format format = Format::CSR);
+
+    std::size_t rows() const noexcept;
+    std::size_t cols() const noexcept;
+    /** Number of stored entries. */
+    std::size_t nonZeros() const noexcept;
+    Format      format() const noexcept;
+
+    /** Same matrix converted to the other (or same) storage format. */
+    SparseMatrix toCSR() const;
+    SparseMatrix toCSC() const;
+    Matrix       toDense() const;
+
+    /** 0-based element lookup (binary search); 0 for entries not stored. */
+    double coeff(std::size_t i, std::size_t j) const;
+
+    /** Main diagonal (length min(rows, cols)), e.g. for a JacobiPreconditioner. */
+    Vector diagonal() const;
+
+    /** y = A·x into a preallocated y of length rows(). */
+    void multiply(const Vector& x, Vector& y) const;
+    /** y = Aᵀ·x into a preallocated y of length cols(). */
+    void transposeMultiply(const Vector& x, Vector& y) const;
+    /**
+     * As above, with the partial sums of a parallel scatter kept in
+     * @p scratch, which only ever grows, so repeated products do not
+     * allocate once it has reached its size.
+     */
+    void multiply(const Vector& x, Vector& y, std::vector<double>& scratch) const;
+    void transposeMultiply(const Vector& x, Vector& y, std::vector<double>& scratch) const;
+    /** A·x. */
+    Vector operator*(const Vector& x) const;
+
+    /** Raw compressed arrays: outer slice k spans [outer[k], outer[k+1]). */
+    const std::vector<std::size_t>& outerIndex() const noexcept;
+    const std::vector<std::size_t>& innerIndex() const noexcept;
+    const std::vector<double>&      values() const noexcept;
+
+private:
+    SparseMatrix(std::size_t rows, std::size_t cols, Format format);
+
+    std::size_t  outerSize() const noexcept;
+    /** The same matrix in the other storage format. */
+    SparseMatrix converted() const;
+
+    std::size_t              mRows, mCols;
+    Format                   mFormat;
+    std::vector<std::size_t> mOuter;
+    std::vector<std::size_t> mInner;
+    std::vector<double>      mValues;
+};
+
+/**
+ * @brief Adapter presenting a SparseMatrix as a LinearOperator (not owned).
+ *
+ * Scatter-direction products reuse an internal buffer, so one instance
+ * must not be applied from several threads at once.
+ */
+class SparseOperator : public LinearOperator {
+public:
+    explicit SparseOperator(const SparseMatrix& A) noexcept;
+
+    std::size_t rows() const noexcept override;
+    std::size_t cols() const noexcept override;
+    void apply(const Vector& x, Vector& y) const override;
+    void applyTranspose(const Vector& x, Vector& y) const override;
+
+private:
+    const SparseMatrix&         mA;
+    mutable std::vector<double> mScratch;
+};
+
+#endif // SPARSEMATRIX_HPP
@@ -0,0 +1,111 @@
+// include/ThreadPool.hpp
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Work-stealing thread pool shared by the library kernels.
+ *
+ * Each worker owns a task deque: it pops its own work LIFO and steals from
+ * the other deques FIFO when idle. The calling thread always takes part in
+ * parallelFor, so nested parallel calls from inside a task cannot deadlock.
+ */
+class ThreadPool {
+public:
+    /** Range body: processes the half-open index range [begin, end). */
+    using RangeFn = std::function<void(std::size_t begin, std::size_t end)>;
+
+    /** Start a pool where @p threads threads (caller included) run work. */
+    explicit ThreadPool(std::size_t threads);
+    /** Join all workers. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Library-wide pool. Sized from the LINALG_NUM_THREADS environment
+     * variable if set, otherwise std::thread::hardware_concurrency().
+     */
+    static ThreadPool& instance();
+
+    /** Number of threads executing work, including the caller. */
+    std::size_t size() const noexcept;
+
+    /** Restart with @p threads threads; must not overlap running work. */
+    void resize(std::size_t threads);
+
+    /**
+     * Run fn over [first, last) split into chunks of exactly @p grain indices
+     * (the last may be shorter) and block until all are done. Chunk c covers
+     * [first + c*grain, ...), so callers may keep one partial result per
+     * chunk for deterministic reductions. Ranges of at most one chunk, or a
+     * single-threaded pool, run inline on the caller. The first exception
+     * thrown by a chunk is rethrown here.
+     */
+    void parallelFor(std::size_t first, std::size_t last, std::size_t grain,
+                     const RangeFn& fn);
+
+    /** Enqueue a fire-and-forget task. */
+    void submit(std::function<void()> task);
+
+private:
+    struct Queue {
+        std::mutex                        mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void start(std::size_t workers);
+    void stop();
+    void workerLoop(std::size_t index);
+    bool tryRun(std::size_t home);
+
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::thread>            mWorkers;
+    std::mutex                          mWakeMutex;
+    std::condition_variable             mWake;
+    std::size_t                         mPending;
+    std::size_t                         mNextQueue;
+    bool                                mStopping;
+};
+
+/** Number of chunks parallelFor splits [0, n) into for a given grain. */
+inline std::size_t chunkCount(std::size_t n, std::size_t grain) noexcept {
+    return grain == 0 ? n : (n + grain - 1) / grain;
+}
+
+/**
+ * ThreadPool::instance().parallelFor(first, last, grain, fn). Work that fits
+ * in one chunk runs inline without type-erasing @p fn, so small problems pay
+ * neither synchronisation nor allocation.
+ */
+template <typename Fn>
+void parallelFor(std::size_t first, std::size_t last, std::size_t grain, Fn&& fn) {
+    if (last <= first)
+        return;
+    if (grain == 0)
+        grain = 1;
+    ThreadPool& pool = ThreadPool::instance();
+    if (last - first <= grain || pool.size() == 1) {
+        for (std::size_t b = first; b < last; b += grain)
+            fn(b, b + grain < last ? b + grain : last);
+        return;
+    }
+    pool.parallelFor(first, last, grain, std::ref(fn));
+}
+
+/** Resize the library-wide pool (threads >= 1, caller included). */
+void setNumThreads(std::size_t threads);
+
+/** Size of the library-wide pool. */
+std::size_t numThreads() noexcept;
+
+#endif // THREADPOOL_HPP
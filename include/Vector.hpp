@@ -4,9 +4,15 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include "Expression.hpp"
+#include "MemoryResource.hpp"
 
 /**
  * @brief Simple dynamic vector class with heap-managed storage.
+ *
+ * +, - and scalar * build lazy expressions (see Expression.hpp) that are
+ * evaluated in a single pass when assigned to a Vector. Storage comes from
+ * the thread's currentResource() (see MemoryResource.hpp).
  */
 class Vector {
 public:
@@ -14,20 +20,44 @@ public:
     explicit Vector(std::size_t size);
     /** Copy constructor. */
     Vector(const Vector& other);
+    /** Move constructor; steals storage, leaves @p other empty. */
+    Vector(Vector&& other) noexcept;
     /** Destructor. */
     ~Vector();
 
     /** Assignment operator. */
     Vector& operator=(const Vector& other);
+    /**
+     * Move assignment; steals storage when both use the same resource,
+     * otherwise copies into this vector's own resource (as std::pmr does).
+     */
+    Vector& operator=(Vector&& other);
 
-    /** Unary plus. */
-    Vector  operator+() const;
-    /** Unary minus. */
-    Vector  operator-() const;
-    /** Vector addition. */
-    Vector  operator+(const Vector& rhs) const;
-    /** Scalar multiplication. */
-    Vector  operator*(double scalar) const;
+    /** Evaluate an element-wise expression in one fused pass. */
+    template <typename Node>
+    Vector(const VectorExpression<Node>& e);
+    /** Assign an expression; evaluated in place, so it may refer to this vector. */
+    template <typename Node>
+    Vector& operator=(const VectorExpression<Node>& e);
+
+    /** In-place addition. */
+    Vector& operator+=(const Vector& rhs);
+    /** In-place subtraction. */
+    Vector& operator-=(const Vector& rhs);
+    /** In-place addition of an expression, fused. */
+    template <typename Node>
+    Vector& operator+=(const VectorExpression<Node>& e);
+    /** In-place subtraction of an expression, fused. */
+    template <typename Node>
+    Vector& operator-=(const VectorExpression<Node>& e);
+    /** In-place scaling. */
+    Vector& operator*=(double scalar);
+    /** this += alpha * x, fused and allocation-free. */
+    Vector& axpy(double alpha, const Vector& x);
+    /** this = alpha * x + beta * this, fused and allocation-free. */
+    Vector& axpby(double alpha, const Vector& x, double beta);
+    /** Inner product. */
+    double  dot(const Vector& rhs) const;
 
     /** 0-based index with bounds check. */
     double&       operator[](std::size_t idx);
@@ -39,10 +69,100 @@ public:
 
     /** Return the size of the vector. */
     std::size_t size() const noexcept;
+    /** Resource the buffer was allocated from. */
+    MemoryResource* resource() const noexcept { return mResource; }
+
+    /** Unchecked access: raw storage and contiguous iterators. */
+    double*       data() noexcept        { return mData; }
+    const double* data() const noexcept  { return mData; }
+    double*       begin() noexcept       { return mData; }
+    const double* begin() const noexcept { return mData; }
+    double*       end() noexcept         { return mData + mSize; }
+    const double* end() const noexcept   { return mData + mSize; }
 
 private:
-    std::size_t mSize;
-    double*     mData;
+    struct Uninitialized {};
+    /** Vector whose elements are left unset. */
+    Vector(std::size_t size, Uninitialized);
+
+    template <typename Node>
+    void evaluate(const VectorExpression<Node>& e) noexcept;
+
+    std::size_t     mSize;
+    MemoryResource* mResource;
+    double*         mData;
 };
 
+// Checked accessors are inline so the compiler can hoist the test out of loops.
+inline double& Vector::operator[](std::size_t idx) {
+    if (idx >= mSize) throw std::out_of_range("Vector index out of range");
+    return mData[idx];
+}
+
+inline const double& Vector::operator[](std::size_t idx) const {
+    if (idx >= mSize) throw std::out_of_range("Vector index out of range");
+    return mData[idx];
+}
+
+inline double& Vector::operator()(std::size_t idx) {
+    if (idx == 0 || idx > mSize) throw std::out_of_range("Vector 1-based index out of range");
+    return mData[idx - 1];
+}
+
+inline const double& Vector::operator()(std::size_t idx) const {
+    if (idx == 0 || idx > mSize) throw std::out_of_range("Vector 1-based index out of range");
+    return mData[idx - 1];
+}
+
+inline std::size_t Vector::size() const noexcept {
+    return mSize;
+}
+
+template <typename Node>
+Vector::Vector(const VectorExpression<Node>& e)
+    : Vector(e.size(), Uninitialized{})
+{
+    evaluate(e);
+}
+
+template <typename Node>
+Vector& Vector::operator=(const VectorExpression<Node>& e) {
+    // Operand sizes are checked on construction, so an expression of a
+    // different size cannot refer to this vector.
+    if (e.size() != mSize)
+        return *this = Vector(e);
+    evaluate(e);
+    return *this;
+}
+
+template <typename Node>
+Vector& Vector::operator+=(const VectorExpression<Node>& e) {
+    if (e.size() != mSize)
+        throw std::length_error("Vector size mismatch in addition");
+    for (std::size_t i = 0; i < mSize; ++i)
+        mData[i] += e.coeff(i);
+    return *this;
+}
+
+template <typename Node>
+Vector& Vector::operator-=(const VectorExpression<Node>& e) {
+    if (e.size() != mSize)
+        throw std::length_error("Vector size mismatch in subtraction");
+    for (std::size_t i = 0; i < mSize; ++i)
+        mData[i] -= e.coeff(i);
+    return *this;
+}
+
+template <typename Node>
+Vector VectorExpression<Node>::eval() const {
+    return Vector(*this);
+}
+
+template <typename Node>
+void Vector::evaluate(const VectorExpression<Node>& e) noexcept {
+    double* out = mData;
+    for (std::size_t i = 0; i < mSize; ++i)
+        out[i] = e.coeff(i);
+}
+
 #endif // VECTOR_HPP
@@ -0,0 +1,207 @@
+// src/BatchedSystems.cpp
+#include "BatchedSystems.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t L = BatchedSystems::kLanes;
+
+// Each thread takes tiles worth roughly this many multiply-adds.
+constexpr std::size_t kTileWork = std::size_t(1) << 16;
+
+// Lane helpers: fixed-length loops over non-aliasing rows, which the
+// compiler turns into straight SIMD code.
+inline void load(double* __restrict acc, const double* __restrict src) {
+    for (std::size_t l = 0; l < L; ++l) acc[l] = src[l];
+}
+inline void store(double* __restrict dst, const double* __restrict acc) {
+    for (std::size_t l = 0; l < L; ++l) dst[l] = acc[l];
+}
+// acc -= x * y
+inline void subMul(double* __restrict acc, const double* __restrict x,
+                   const double* __restrict y) {
+    for (std::size_t l = 0; l < L; ++l) acc[l] -= x[l] * y[l];
+}
+inline void divide(double* __restrict acc, const double* __restrict d) {
+    for (std::size_t l = 0; l < L; ++l) acc[l] /= d[l];
+}
+
+// In-place Cholesky solve of one tile of L systems at lane offset 0 of
+// A/b (strides as in the batch); fail[l] is set for non-PD systems.
+void choleskyTile(std::size_t n, std::size_t stride, double* A, double* b,
+                  unsigned char* fail)
+{
+    auto a = [&](std::size_t i, std::size_t j) { return A + (i * n + j) * stride; };
+    double acc[L], diag[L];
+    for (std::size_t j = 0; j < n; ++j) {
+        load(acc, a(j, j));
+        for (std::size_t k = 0; k < j; ++k)
+            subMul(acc, a(j, k), a(j, k));
+        for (std::size_t l = 0; l < L; ++l) {
+            const bool bad = !(acc[l] > 0.0);
+            fail[l] |= bad;
+            diag[l] = bad ? 1.0 : std::sqrt(acc[l]);   // keep the sweep finite
+        }
+        store(a(j, j), diag);
+        for (std::size_t i = j + 1; i < n; ++i) {
+            load(acc, a(i, j));
+            for (std::size_t k = 0; k < j; ++k)
+                subMul(acc, a(i, k), a(j, k));
+            divide(acc, diag);
+            store(a(i, j), acc);
+        }
+    }
+    // L y = b, then Lᵀ x = y.
+    for (std::size_t i = 0; i < n; ++i) {
+        load(acc, b + i * stride);
+        for (std::size_t k = 0; k < i; ++k)
+            subMul(acc, a(i, k), b + k * stride);
+        divide(acc, a(i, i));
+        store(b + i * stride, acc);
+    }
+    for (std::size_t i = n; i-- > 0;) {
+        load(acc, b + i * stride);
+        for (std::size_t k = i + 1; k < n; ++k)
+            subMul(acc, a(k, i), b + k * stride);
+        divide(acc, a(i, i));
+        store(b + i * stride, acc);
+    }
+}
+
+// In-place Gaussian elimination with per-lane partial pivoting; b is
+// eliminated alongside, so columns left of the pivot need not be swapped.
+void luTile(std::size_t n, std::size_t stride, double* A, double* b, unsigned char* fail)
+{
+    auto a = [&](std::size_t i, std::size_t j) { return A + (i * n + j) * stride; };
+    double acc[L], pivot[L], factor[L];
+
+    // A pivot at most n·ε times the lane's largest |a_ij| is rounding noise;
+    // relative, so a uniformly scaled system is not flagged.
+    double tol[L] = {};
+    for (std::size_t ij = 0; ij < n * n; ++ij) {
+        const double* e = A + ij * stride;
+        for (std::size_t l = 0; l < L; ++l)
+            tol[l] = std::max(tol[l], std::abs(e[l]));
+    }
+    for (std::size_t l = 0; l < L; ++l)
+        tol[l] *= double(n) * std::numeric_limits<double>::epsilon();
+
+    for (std::size_t k = 0; k < n; ++k) {
+        // Pivot search and row swap differ per lane.
+        for (std::size_t l = 0; l < L; ++l) {
+            std::size_t p = k;
+            double best = std::abs(a(k, k)[l]);
+            for (std::size_t i = k + 1; i < n; ++i) {
+                const double v = std::abs(a(i, k)[l]);
+                if (v > best) { best = v; p = i; }
+            }
+            if (p != k) {
+                for (std::size_t j = k; j < n; ++j)
+                    std::swap(a(k, j)[l], a(p, j)[l]);
+                std::swap(b[k * stride + l], b[p * stride + l]);
+            }
+        }
+        load(pivot, a(k, k));
+        for (std::size_t l = 0; l < L; ++l) {
+            const bool bad = !(std::abs(pivot[l]) > tol[l]);   // also NaN
+            fail[l] |= bad;
+            if (bad) pivot[l] = 1.0;
+        }
+        store(a(k, k), pivot);
+        // Elimination is uniform across lanes.
+        for (std::size_t i = k + 1; i < n; ++i) {
+            load(factor, a(i, k));
+            divide(factor, pivot);
+            for (std::size_t j = k + 1; j < n; ++j) {
+                load(acc, a(i, j));
+                subMul(acc, factor, a(k, j));
+                store(a(i, j), acc);
+            }
+            load(acc, b + i * stride);
+            subMul(acc, factor, b + k * stride);
+            store(b + i * stride, acc);
+        }
+    }
+    for (std::size_t i = n; i-- > 0;) {
+        load(acc, b + i * stride);
+        for (std::size_t k = i + 1; k < n; ++k)
+            subMul(acc, a(i, k), b + k * stride);
+        divide(acc, a(i, i));
+        store(b + i * stride, acc);
+    }
+}
+
+} // namespace
+
+BatchedSystems::BatchedSystems(std::size_t n, std::size_t count)
+    : mN(n), mCount(count), mStride((count + kLanes - 1) / kLanes * kLanes),
+      mA(n * n * mStride, 0.0), mB(n * mStride, 0.0), mFailed(mStride, 0)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t s = count; s < mStride; ++s)
+            mA[(i * n + i) * mStride + s] = 1.0;
+}
+
+std::size_t BatchedSystems::size() const noexcept { return mN; }
+std::size_t BatchedSystems::count() const noexcept { return mCount; }
+std::size_t BatchedSystems::stride() const noexcept { return mStride; }
+double*       BatchedSystems::A() noexcept       { return mA.data(); }
+const double* BatchedSystems::A() const noexcept { return mA.data(); }
+double*       BatchedSystems::b() noexcept       { return mB.data(); }
+const double* BatchedSystems::b() const noexcept { return mB.data(); }
+
+void BatchedSystems::setSystem(std::size_t s, const Matrix& A, const Vector& b) {
+    if (s >= mCount)
+        throw std::out_of_range("System index out of range");
+    if (A.rows() != mN || A.cols() != mN || b.size() != mN)
+        throw std::length_error("System has the wrong size");
+    for (std::size_t i = 0; i < mN; ++i) {
+        const double* ai = A.row(i);
+        for (std::size_t j = 0; j < mN; ++j)
+            mA[(i * mN + j) * mStride + s] = ai[j];
+        mB[i * mStride + s] = b[i];
+    }
+}
+
+Vector BatchedSystems::solution(std::size_t s) const {
+    if (s >= mCount)
+        throw std::out_of_range("System index out of range");
+    Vector x(mN);
+    for (std::size_t i = 0; i < mN; ++i)
+        x[i] = mB[i * mStride + s];
+    return x;
+}
+
+bool BatchedSystems::succeeded(std::size_t s) const {
+    if (s >= mCount)
+        throw std::out_of_range("System index out of range");
+    return !mFailed[s];
+}
+
+template <typename TileSolver>
+std::size_t BatchedSystems::solveTiles(TileSolver&& solveTile) {
+    std::fill(mFailed.begin(), mFailed.end(), 0);
+    const std::size_t tiles = mStride / kLanes;
+    const std::size_t work  = std::max<std::size_t>(1, kLanes * mN * mN * mN);
+    const std::size_t grain = std::max<std::size_t>(1, kTileWork / work);
+    parallelFor(0, tiles, grain, [&](std::size_t t0, std::size_t t1) {
+        for (std::size_t t = t0; t < t1; ++t) {
+            const std::size_t s = t * kLanes;
+            solveTile(mN, mStride, mA.data() + s, mB.data() + s, mFailed.data() + s);
+        }
+    });
+    return static_cast<std::size_t>(
+        std::count(mFailed.begin(), mFailed.begin() + static_cast<std::ptrdiff_t>(mCount), 1));
+}
+
+std::size_t BatchedSystems::solveCholesky() {
+    return solveTiles(choleskyTile);
+}
+
+std::size_t BatchedSystems::solveLU() {
+    return solveTiles(luTile);
+}
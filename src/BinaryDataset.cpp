@@ -0,0 +1,258 @@
+// src/BinaryDataset.cpp
+#include "BinaryDataset.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+constexpr char          kMagic[8]  = { 'L', 'A', 'D', 'S', 'B', 'I', 'N', '1' };
+constexpr std::uint32_t kVersion   = 1;
+constexpr std::uint32_t kFloat64   = 1;
+constexpr std::size_t   kAlign     = 64;
+constexpr std::size_t   kChunkRows = 65536;
+
+struct Header {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t dtype;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t namesOffset;
+    std::uint64_t namesBytes;
+    std::uint64_t featuresOffset;
+    std::uint64_t targetOffset;
+};
+static_assert(sizeof(Header) == 64, "Binary dataset header must be 64 bytes");
+
+bool littleEndian() {
+    const std::uint16_t one = 1;
+    unsigned char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+std::uint64_t alignUp(std::uint64_t x) {
+    return (x + kAlign - 1) / kAlign * kAlign;
+}
+
+std::uint64_t namesSize(const std::vector<std::string>& names) {
+    std::uint64_t n = 0;
+    for (const std::string& s : names)
+        n += sizeof(std::uint32_t) + s.size();
+    return n;
+}
+
+// Fill in the section offsets for a rows × cols dataset with these names.
+Header makeHeader(std::uint64_t rows, std::uint64_t cols, std::uint64_t namesBytes) {
+    Header h{};
+    std::memcpy(h.magic, kMagic, sizeof kMagic);
+    h.version        = kVersion;
+    h.dtype          = kFloat64;
+    h.rows           = rows;
+    h.cols           = cols;
+    h.namesOffset    = sizeof(Header);
+    h.namesBytes     = namesBytes;
+    h.featuresOffset = alignUp(h.namesOffset + namesBytes);
+    h.targetOffset   = alignUp(h.featuresOffset + rows * cols * sizeof(double));
+    return h;
+}
+
+void check(const std::ostream& out, const std::string& path) {
+    if (!out)
+        throw std::runtime_error("Cannot write binary dataset: " + path);
+}
+
+void writeNames(std::ostream& out, const std::vector<std::string>& names) {
+    for (const std::string& s : names) {
+        const std::uint32_t len = static_cast<std::uint32_t>(s.size());
+        out.write(reinterpret_cast<const char*>(&len), sizeof len);
+        out.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+}
+
+void padTo(std::ostream& out, std::uint64_t offset) {
+    static const char zeros[kAlign] = {};
+    const std::uint64_t pos = static_cast<std::uint64_t>(out.tellp());
+    if (pos < offset)
+        out.write(zeros, static_cast<std::streamsize>(offset - pos));
+}
+
+// Names for the header: features (plus "intercept") then target.
+std::vector<std::string> headerNames(const std::string& csvPath, const CsvSchema& schema) {
+    std::vector<std::string> features, target;
+    if (schema.header) {
+        std::ifstream in(csvPath);
+        std::string line;
+        std::getline(in, line);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        std::size_t col = 0, pos = 0;
+        for (;;) {
+            const std::size_t sep = line.find(schema.delimiter, pos);
+            const std::string field = line.substr(pos, sep == std::string::npos ? std::string::npos : sep - pos);
+            if (col < schema.columns.size()) {
+                if (schema.columns[col] == ColumnRole::Feature)     features.push_back(field);
+                else if (schema.columns[col] == ColumnRole::Target) target.push_back(field);
+            }
+            ++col;
+            if (sep == std::string::npos)
+                break;
+            pos = sep + 1;
+        }
+    }
+    if (features.size() + (schema.intercept ? 1 : 0) != schema.features() || target.size() != 1)
+        return {};
+    if (schema.intercept)
+        features.push_back("intercept");
+    features.push_back(target.front());
+    return features;
+}
+
+} // namespace
+
+void writeBinaryDataset(const std::string& path, MatrixView X, Span<const double> y,
+                        const std::vector<std::string>& featureNames,
+                        const std::string& targetName)
+{
+    if (y.size() != X.rows())
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (!featureNames.empty() && featureNames.size() != X.cols())
+        throw std::length_error("Need one name per feature column");
+    if (!littleEndian())
+        throw std::runtime_error("Binary datasets are only supported on little-endian hosts");
+
+    std::vector<std::string> names(featureNames);
+    names.resize(X.cols());
+    names.push_back(targetName);
+    const Header h = makeHeader(X.rows(), X.cols(), namesSize(names));
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    check(out, path);
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    writeNames(out, names);
+    padTo(out, h.featuresOffset);
+    for (std::size_t i = 0; i < X.rows(); ++i)
+        out.write(reinterpret_cast<const char*>(X.row(i)),
+                  static_cast<std::streamsize>(X.cols() * sizeof(double)));
+    padTo(out, h.targetOffset);
+    out.write(reinterpret_cast<const char*>(y.data()),
+              static_cast<std::streamsize>(y.size() * sizeof(double)));
+    check(out, path);
+}
+
+void convertCsvToBinary(const std::string& csvPath, const CsvSchema& schema,
+                        const std::string& binaryPath)
+{
+    if (!littleEndian())
+        throw std::runtime_error("Binary datasets are only supported on little-endian hosts");
+    CsvReader reader(csvPath, schema);
+    std::vector<std::string> names = headerNames(csvPath, schema);
+    if (names.empty())
+        names.resize(schema.features() + 1);
+    const std::uint64_t cols = schema.features();
+
+    // Features are streamed straight after a provisional header; the real
+    // header is written once the row count is known.
+    std::ofstream out(binaryPath, std::ios::binary | std::ios::trunc);
+    check(out, binaryPath);
+    Header h = makeHeader(0, cols, namesSize(names));
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    writeNames(out, names);
+    padTo(out, h.featuresOffset);
+
+    Matrix X(kChunkRows, cols);
+    Vector yChunk(kChunkRows);
+    std::vector<double> target;
+    while (std::size_t n = reader.readChunk(X, yChunk)) {
+        out.write(reinterpret_cast<const char*>(X.data()),
+                  static_cast<std::streamsize>(n * cols * sizeof(double)));
+        target.insert(target.end(), yChunk.data(), yChunk.data() + n);
+        check(out, binaryPath);
+    }
+
+    h = makeHeader(target.size(), cols, namesSize(names));
+    padTo(out, h.targetOffset);
+    out.write(reinterpret_cast<const char*>(target.data()),
+              static_cast<std::streamsize>(target.size() * sizeof(double)));
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    check(out, binaryPath);
+}
+
+bool isBinaryDataset(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    char magic[sizeof kMagic];
+    return in.read(magic, sizeof magic) && std::memcmp(magic, kMagic, sizeof kMagic) == 0;
+}
+
+BinaryDataset::BinaryDataset(const std::string& path)
+    : mFile(path), mRows(0), mCols(0), mFeatures(nullptr), mTarget(nullptr)
+{
+    auto bad = [&](const char* why) {
+        return std::runtime_error("Invalid binary dataset " + path + ": " + why);
+    };
+    if (mFile.size() < sizeof(Header))
+        throw bad("file too short");
+    Header h;
+    std::memcpy(&h, mFile.data(), sizeof h);
+    if (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0)
+        throw bad("bad magic");
+    if (h.version != kVersion)
+        throw bad("unsupported version");
+    if (h.dtype != kFloat64 || !littleEndian())
+        throw bad("unsupported dtype");
+
+    // Every bound is checked by division or subtraction so that a corrupt
+    // header cannot wrap a u64 product past the file size.
+    const std::uint64_t size = mFile.size();
+    const std::uint64_t maxDoubles = size / sizeof(double);
+    if (h.rows > maxDoubles || (h.cols != 0 && h.rows > maxDoubles / h.cols) ||
+        h.namesOffset > size || h.namesBytes > size - h.namesOffset ||
+        h.featuresOffset % kAlign != 0 || h.featuresOffset > size ||
+        h.rows * h.cols > (size - h.featuresOffset) / sizeof(double) ||
+        h.targetOffset % kAlign != 0 || h.targetOffset > size ||
+        h.rows > (size - h.targetOffset) / sizeof(double))
+        throw bad("section out of bounds");
+
+    const char* p   = mFile.data() + h.namesOffset;
+    const char* end = p + h.namesBytes;
+    std::vector<std::string> names;
+    while (p < end && names.size() < h.cols + 1) {
+        std::uint32_t len;
+        if (std::size_t(end - p) < sizeof len)
+            throw bad("truncated names");
+        std::memcpy(&len, p, sizeof len);
+        p += sizeof len;
+        if (std::size_t(end - p) < len)
+            throw bad("truncated names");
+        names.emplace_back(p, len);
+        p += len;
+    }
+    if (names.size() != h.cols + 1)
+        throw bad("wrong number of column names");
+
+    mRows = static_cast<std::size_t>(h.rows);
+    mCols = static_cast<std::size_t>(h.cols);
+    mFeatures = reinterpret_cast<const double*>(mFile.data() + h.featuresOffset);
+    mTarget   = reinterpret_cast<const double*>(mFile.data() + h.targetOffset);
+    mTargetName = names.back();
+    names.pop_back();
+    mFeatureNames = std::move(names);
+}
+
+std::size_t BinaryDataset::rows() const noexcept { return mRows; }
+std::size_t BinaryDataset::cols() const noexcept { return mCols; }
+
+MatrixView BinaryDataset::features() const noexcept {
+    return MatrixView(mFeatures, mRows, mCols, mCols);
+}
+
+Span<const double> BinaryDataset::target() const noexcept {
+    return Span<const double>(mTarget, mRows);
+}
+
+const std::vector<std::string>& BinaryDataset::featureNames() const noexcept { return mFeatureNames; }
+const std::string& BinaryDataset::targetName() const noexcept { return mTargetName; }
@@ -0,0 +1,605 @@
+// src/Blas.cpp
+#include "Blas.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define LINALG_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define LINALG_X86_KERNELS 0
+#endif
+
+namespace {
+
+// Blocking parameters (in elements): a KC×NR sliver of B stays in L1, an
+// MC×KC block of A in L2 and a KC×NC panel of B in L3.
+constexpr std::size_t kMC = 192;
+constexpr std::size_t kKC = 256;
+constexpr std::size_t kNC = 4096;
+
+// Products with fewer multiply-adds than this skip packing entirely.
+constexpr std::size_t kSmallWork = 32 * 32 * 32;
+// Products with at least this many multiply-adds are split across threads.
+constexpr std::size_t kParallelWork = 128 * 128 * 128;
+
+constexpr std::size_t kMaxMR = 8;
+constexpr std::size_t kMaxNR = 32;
+
+/**
+ * c[i*ldc + j] += alpha * sum_p a[p*MR + i] * b[p*NR + j] for one MR×NR tile,
+ * where a and b are packed panels of depth kc.
+ */
+template <typename T>
+using MicroKernel = void (*)(std::size_t kc, const T* a, const T* b,
+                             T alpha, T* c, std::size_t ldc);
+
+template <typename T>
+struct KernelInfo {
+    std::size_t mr, nr;
+    MicroKernel<T> fn;
+    const char* name;
+};
+
+template <typename T, std::size_t MR, std::size_t NR>
+void scalarKernel(std::size_t kc, const T* a, const T* b,
+                  T alpha, T* c, std::size_t ldc)
+{
+    T acc[MR][NR] = {};
+    for (std::size_t p = 0; p < kc; ++p, a += MR, b += NR)
+        for (std::size_t i = 0; i < MR; ++i)
+            for (std::size_t j = 0; j < NR; ++j)
+                acc[i][j] += a[i] * b[j];
+    for (std::size_t i = 0; i < MR; ++i)
+        for (std::size_t j = 0; j < NR; ++j)
+            c[i * ldc + j] += alpha * acc[i][j];
+}
+
+#if LINALG_X86_KERNELS
+
+// 4×8 tile: eight ymm accumulators, two B loads and one broadcast per step.
+__attribute__((target("avx2,fma")))
+void avx2Kernel(std::size_t kc, const double* a, const double* b,
+                double alpha, double* c, std::size_t ldc)
+{
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    for (std::size_t p = 0; p < kc; ++p, a += 4, b += 8) {
+        const __m256d b0 = _mm256_loadu_pd(b);
+        const __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d ai = _mm256_broadcast_sd(a);
+        c00 = _mm256_fmadd_pd(ai, b0, c00); c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10); c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20); c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30); c31 = _mm256_fmadd_pd(ai, b1, c31);
+    }
+    const __m256d va = _mm256_set1_pd(alpha);
+#define LINALG_AVX2_STORE(r, lo, hi)                                                   \
+    _mm256_storeu_pd(c + (r) * ldc,     _mm256_fmadd_pd(va, lo, _mm256_loadu_pd(c + (r) * ldc)));     \
+    _mm256_storeu_pd(c + (r) * ldc + 4, _mm256_fmadd_pd(va, hi, _mm256_loadu_pd(c + (r) * ldc + 4)));
+    LINALG_AVX2_STORE(0, c00, c01)
+    LINALG_AVX2_STORE(1, c10, c11)
+    LINALG_AVX2_STORE(2, c20, c21)
+    LINALG_AVX2_STORE(3, c30, c31)
+#undef LINALG_AVX2_STORE
+}
+
+// 8×16 tile: sixteen zmm accumulators out of the 32 available.
+__attribute__((target("avx512f")))
+void avx512Kernel(std::size_t kc, const double* a, const double* b,
+                  double alpha, double* c, std::size_t ldc)
+{
+    __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+    __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+    __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+    __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+    __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+    __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+    __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+    __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+    for (std::size_t p = 0; p < kc; ++p, a += 8, b += 16) {
+        const __m512d b0 = _mm512_loadu_pd(b);
+        const __m512d b1 = _mm512_loadu_pd(b + 8);
+#define LINALG_AVX512_STEP(r, lo, hi)                 \
+        {                                             \
+            const __m512d ai = _mm512_set1_pd(a[r]);  \
+            lo = _mm512_fmadd_pd(ai, b0, lo);         \
+            hi = _mm512_fmadd_pd(ai, b1, hi);         \
+        }
+        LINALG_AVX512_STEP(0, c00, c01)
+        LINALG_AVX512_STEP(1, c10, c11)
+        LINALG_AVX512_STEP(2, c20, c21)
+        LINALG_AVX512_STEP(3, c30, c31)
+        LINALG_AVX512_STEP(4, c40, c41)
+        LINALG_AVX512_STEP(5, c50, c51)
+        LINALG_AVX512_STEP(6, c60, c61)
+        LINALG_AVX512_STEP(7, c70, c71)
+#undef LINALG_AVX512_STEP
+    }
+    const __m512d va = _mm512_set1_pd(alpha);
+#define LINALG_AVX512_STORE(r, lo, hi)                                                 \
+    _mm512_storeu_pd(c + (r) * ldc,     _mm512_fmadd_pd(va, lo, _mm512_loadu_pd(c + (r) * ldc)));     \
+    _mm512_storeu_pd(c + (r) * ldc + 8, _mm512_fmadd_pd(va, hi, _mm512_loadu_pd(c + (r) * ldc + 8)));
+    LINALG_AVX512_STORE(0, c00, c01)
+    LINALG_AVX512_STORE(1, c10, c11)
+    LINALG_AVX512_STORE(2, c20, c21)
+    LINALG_AVX512_STORE(3, c30, c31)
+    LINALG_AVX512_STORE(4, c40, c41)
+    LINALG_AVX512_STORE(5, c50, c51)
+    LINALG_AVX512_STORE(6, c60, c61)
+    LINALG_AVX512_STORE(7, c70, c71)
+#undef LINALG_AVX512_STORE
+}
+
+// Single-precision tiles hold twice as many columns per register: 4×16 in
+// eight ymm accumulators and 8×32 in sixteen zmm accumulators.
+__attribute__((target("avx2,fma")))
+void avx2KernelFloat(std::size_t kc, const float* a, const float* b,
+                     float alpha, float* c, std::size_t ldc)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    for (std::size_t p = 0; p < kc; ++p, a += 4, b += 16) {
+        const __m256 b0 = _mm256_loadu_ps(b);
+        const __m256 b1 = _mm256_loadu_ps(b + 8);
+        __m256 ai = _mm256_broadcast_ss(a);
+        c00 = _mm256_fmadd_ps(ai, b0, c00); c01 = _mm256_fmadd_ps(ai, b1, c01);
+        ai = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(ai, b0, c10); c11 = _mm256_fmadd_ps(ai, b1, c11);
+        ai = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(ai, b0, c20); c21 = _mm256_fmadd_ps(ai, b1, c21);
+        ai = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(ai, b0, c30); c31 = _mm256_fmadd_ps(ai, b1, c31);
+    }
+    const __m256 va = _mm256_set1_ps(alpha);
+#define LINALG_AVX2_STORE(r, lo, hi)                                                   \
+    _mm256_storeu_ps(c + (r) * ldc,     _mm256_fmadd_ps(va, lo, _mm256_loadu_ps(c + (r) * ldc)));     \
+    _mm256_storeu_ps(c + (r) * ldc + 8, _mm256_fmadd_ps(va, hi, _mm256_loadu_ps(c + (r) * ldc + 8)));
+    LINALG_AVX2_STORE(0, c00, c01)
+    LINALG_AVX2_STORE(1, c10, c11)
+    LINALG_AVX2_STORE(2, c20, c21)
+    LINALG_AVX2_STORE(3, c30, c31)
+#undef LINALG_AVX2_STORE
+}
+
+__attribute__((target("avx512f")))
+void avx512KernelFloat(std::size_t kc, const float* a, const float* b,
+                       float alpha, float* c, std::size_t ldc)
+{
+    __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+    __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+    __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+    __m512 c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+    for (std::size_t p = 0; p < kc; ++p, a += 8, b += 32) {
+        const __m512 b0 = _mm512_loadu_ps(b);
+        const __m512 b1 = _mm512_loadu_ps(b + 16);
+#define LINALG_AVX512_STEP(r, lo, hi)                 \
+        {                                             \
+            const __m512 ai = _mm512_set1_ps(a[r]);   \
+            lo = _mm512_fmadd_ps(ai, b0, lo);         \
+            hi = _mm512_fmadd_ps(ai, b1, hi);         \
+        }
+        LINALG_AVX512_STEP(0, c00, c01)
+        LINALG_AVX512_STEP(1, c10, c11)
+        LINALG_AVX512_STEP(2, c20, c21)
+        LINALG_AVX512_STEP(3, c30, c31)
+        LINALG_AVX512_STEP(4, c40, c41)
+        LINALG_AVX512_STEP(5, c50, c51)
+        LINALG_AVX512_STEP(6, c60, c61)
+        LINALG_AVX512_STEP(7, c70, c71)
+#undef LINALG_AVX512_STEP
+    }
+    const __m512 va = _mm512_set1_ps(alpha);
+#define LINALG_AVX512_STORE(r, lo, hi)                                                 \
+    _mm512_storeu_ps(c + (r) * ldc,      _mm512_fmadd_ps(va, lo, _mm512_loadu_ps(c + (r) * ldc)));      \
+    _mm512_storeu_ps(c + (r) * ldc + 16, _mm512_fmadd_ps(va, hi, _mm512_loadu_ps(c + (r) * ldc + 16)));
+    LINALG_AVX512_STORE(0, c00, c01)
+    LINALG_AVX512_STORE(1, c10, c11)
+    LINALG_AVX512_STORE(2, c20, c21)
+    LINALG_AVX512_STORE(3, c30, c31)
+    LINALG_AVX512_STORE(4, c40, c41)
+    LINALG_AVX512_STORE(5, c50, c51)
+    LINALG_AVX512_STORE(6, c60, c61)
+    LINALG_AVX512_STORE(7, c70, c71)
+#undef LINALG_AVX512_STORE
+}
+
+#endif // LINALG_X86_KERNELS
+
+// Which instruction set LINALG_GEMM_KERNEL=scalar|avx2|avx512 and the CPU
+// allow; both precisions use the same level.
+enum class KernelLevel { Scalar, Avx2, Avx512 };
+
+KernelLevel kernelLevel() {
+    static const KernelLevel level = [] {
+        const char* env = std::getenv("LINALG_GEMM_KERNEL");
+        const std::string cap = env ? env : "";
+        if (cap == "scalar")
+            return KernelLevel::Scalar;
+#if LINALG_X86_KERNELS
+        __builtin_cpu_init();
+        const bool fma = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        if (cap != "avx2" && __builtin_cpu_supports("avx512f"))
+            return KernelLevel::Avx512;
+        if (fma)
+            return KernelLevel::Avx2;
+#endif
+        return KernelLevel::Scalar;
+    }();
+    return level;
+}
+
+// Pick the widest kernel the CPU supports (capped by LINALG_GEMM_KERNEL,
+// useful for testing and benchmarking).
+template <typename T> const KernelInfo<T>& selectKernel();
+
+template <>
+const KernelInfo<double>& selectKernel<double>() {
+    static const KernelInfo<double> info = [] {
+#if LINALG_X86_KERNELS
+        switch (kernelLevel()) {
+        case KernelLevel::Avx512: return KernelInfo<double>{8, 16, avx512Kernel, "avx512"};
+        case KernelLevel::Avx2:   return KernelInfo<double>{4, 8, avx2Kernel, "avx2"};
+        case KernelLevel::Scalar: break;
+        }
+#endif
+        return KernelInfo<double>{4, 8, scalarKernel<double, 4, 8>, "scalar"};
+    }();
+    return info;
+}
+
+template <>
+const KernelInfo<float>& selectKernel<float>() {
+    static const KernelInfo<float> info = [] {
+#if LINALG_X86_KERNELS
+        switch (kernelLevel()) {
+        case KernelLevel::Avx512: return KernelInfo<float>{8, 32, avx512KernelFloat, "avx512"};
+        case KernelLevel::Avx2:   return KernelInfo<float>{4, 16, avx2KernelFloat, "avx2"};
+        case KernelLevel::Scalar: break;
+        }
+#endif
+        return KernelInfo<float>{4, 16, scalarKernel<float, 4, 16>, "scalar"};
+    }();
+    return info;
+}
+
+// Copy an mc×kc block of op(A) (element (i,p) at A[i*rs + p*cs]) into
+// mr-row panels laid out p-major, zero-padding the last panel.
+template <typename T>
+void packA(std::size_t mc, std::size_t kc, const T* A,
+           std::size_t rs, std::size_t cs, std::size_t mr, T* buf)
+{
+    for (std::size_t i0 = 0; i0 < mc; i0 += mr) {
+        const std::size_t ib = std::min(mr, mc - i0);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const T* src = A + i0 * rs + p * cs;
+            std::size_t i = 0;
+            for (; i < ib; ++i) *buf++ = src[i * rs];
+            for (; i < mr; ++i) *buf++ = T(0);
+        }
+    }
+}
+
+// Copy a kc×nc block of op(B) into nr-column panels laid out p-major.
+template <typename T>
+void packB(std::size_t kc, std::size_t nc, const T* B,
+           std::size_t rs, std::size_t cs, std::size_t nr, T* buf)
+{
+    for (std::size_t j0 = 0; j0 < nc; j0 += nr) {
+        const std::size_t jb = std::min(nr, nc - j0);
+        for (std::size_t p = 0; p < kc; ++p) {
+            const T* src = B + p * rs + j0 * cs;
+            std::size_t j = 0;
+            if (cs == 1) {
+                std::memcpy(buf, src, jb * sizeof(T));
+                buf += jb;
+                j = jb;
+            } else {
+                for (; j < jb; ++j) *buf++ = src[j * cs];
+            }
+            for (; j < nr; ++j) *buf++ = T(0);
+        }
+    }
+}
+
+std::size_t roundUp(std::size_t x, std::size_t to) {
+    return (x + to - 1) / to * to;
+}
+
+// Gram kernel: rows are split into at most kGramMaxBlocks blocks of at least
+// kGramRows rows, each accumulating a private lower triangle; the partials
+// cost at most kGramBudget doubles. Wider than kGramGemmCols, each block's
+// lower panels go through gemm instead of rank-1 row updates.
+constexpr std::size_t kGramRows      = 4096;
+constexpr std::size_t kGramMaxBlocks = 64;
+constexpr std::size_t kGramBudget    = std::size_t(1) << 22;
+constexpr std::size_t kGramGemmCols  = 32;
+constexpr std::size_t kGramPanel     = 128;
+
+// Lower triangle of G += X[r0:r1]ᵀ X[r0:r1] (diagonal panels may spill into
+// the upper triangle) and g += X[r0:r1]ᵀ y[r0:r1] when y is given.
+void gramBlock(std::size_t r0, std::size_t r1, std::size_t n,
+               const double* X, std::size_t ldx, const double* y,
+               double* G, std::size_t ldg, double* g)
+{
+    if (n < kGramGemmCols) {
+        for (std::size_t k = r0; k < r1; ++k) {
+            const double* xk = X + k * ldx;
+            for (std::size_t i = 0; i < n; ++i) {
+                double*      gi = G + i * ldg;
+                const double xi = xk[i];
+                for (std::size_t j = 0; j <= i; ++j)
+                    gi[j] += xi * xk[j];
+            }
+            if (y) {
+                const double yk = y[k];
+                for (std::size_t i = 0; i < n; ++i)
+                    g[i] += xk[i] * yk;
+            }
+        }
+        return;
+    }
+    const double* Xb = X + r0 * ldx;
+    for (std::size_t J = 0; J < n; J += kGramPanel) {
+        const std::size_t nj = std::min(kGramPanel, n - J);
+        for (std::size_t I = J; I < n; I += kGramPanel) {
+            const std::size_t ni = std::min(kGramPanel, n - I);
+            gemm(Transpose::Yes, Transpose::No, ni, nj, r1 - r0,
+                 1.0, Xb + I, ldx, Xb + J, ldx, 1.0, G + I * ldg + J, ldg);
+        }
+    }
+    if (y) {
+        for (std::size_t k = r0; k < r1; ++k) {
+            const double* xk = X + k * ldx;
+            const double  yk = y[k];
+            for (std::size_t i = 0; i < n; ++i)
+                g[i] += xk[i] * yk;
+        }
+    }
+}
+
+// The blocked gemm driver, shared by both precisions.
+template <typename T>
+void gemmImpl(Transpose transA, Transpose transB,
+              std::size_t m, std::size_t n, std::size_t k,
+              T alpha, const T* A, std::size_t lda,
+              const T* B, std::size_t ldb,
+              T beta, T* C, std::size_t ldc)
+{
+    if (m == 0 || n == 0)
+        return;
+
+    // Apply beta once so every later pass is a pure accumulation.
+    if (beta != T(1)) {
+        for (std::size_t i = 0; i < m; ++i) {
+            T* c = C + i * ldc;
+            if (beta == T(0))
+                std::fill(c, c + n, T(0));
+            else
+                for (std::size_t j = 0; j < n; ++j)
+                    c[j] *= beta;
+        }
+    }
+    if (k == 0 || alpha == T(0))
+        return;
+
+    // Element (i,p) of op(A) is A[i*rsa + p*csa]; likewise for op(B).
+    const std::size_t rsa = transA == Transpose::No ? lda : 1;
+    const std::size_t csa = transA == Transpose::No ? 1 : lda;
+    const std::size_t rsb = transB == Transpose::No ? ldb : 1;
+    const std::size_t csb = transB == Transpose::No ? 1 : ldb;
+
+    if (m * n * k <= kSmallWork) {
+        for (std::size_t i = 0; i < m; ++i) {
+            T* c = C + i * ldc;
+            for (std::size_t p = 0; p < k; ++p) {
+                const T  aip = alpha * A[i * rsa + p * csa];
+                const T* b   = B + p * rsb;
+                for (std::size_t j = 0; j < n; ++j)
+                    c[j] += aip * b[j * csb];
+            }
+        }
+        return;
+    }
+
+    const KernelInfo<T>& ker = selectKernel<T>();
+    const std::size_t mr = ker.mr, nr = ker.nr;
+
+    // Sized for the largest panel this product packs and grown only when a
+    // bigger one comes along, so steady-state calls do not allocate.
+    const std::size_t kcMax = std::min(k, kKC);
+    thread_local std::vector<T> bufB;
+    bufB.resize(std::max(bufB.size(), roundUp(std::min(n, kNC), nr) * kcMax));
+
+    const bool parallel = m * n * k >= kParallelWork && numThreads() > 1;
+
+    for (std::size_t jc = 0; jc < n; jc += kNC) {
+        const std::size_t nc = std::min(kNC, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kKC) {
+            const std::size_t kc = std::min(kKC, k - pc);
+            packB(kc, nc, B + pc * rsb + jc * csb, rsb, csb, nr, bufB.data());
+            const T* packedB = bufB.data();
+
+            // Tasks are (MC block of A) × (group of NR panels of B). When A has
+            // too few blocks to feed every thread, the B panels are split too.
+            const std::size_t icBlocks = chunkCount(m, kMC);
+            const std::size_t panels   = chunkCount(nc, nr);
+            std::size_t groups = 1;
+            if (parallel)
+                groups = std::min(panels, chunkCount(2 * numThreads(), icBlocks));
+            const std::size_t panelsPerGroup = chunkCount(panels, groups);
+            groups = chunkCount(panels, panelsPerGroup);
+
+            auto macroKernel = [&](std::size_t t0, std::size_t t1) {
+                thread_local std::vector<T> bufA;
+                bufA.resize(std::max(bufA.size(), roundUp(std::min(m, kMC), mr) * kcMax));
+                T tile[kMaxMR * kMaxNR];
+                std::size_t packedBlock = icBlocks;  // none yet
+
+                for (std::size_t t = t0; t < t1; ++t) {
+                    const std::size_t blk = t / groups;
+                    const std::size_t ic  = blk * kMC;
+                    const std::size_t mc  = std::min(kMC, m - ic);
+                    if (blk != packedBlock) {
+                        packA(mc, kc, A + ic * rsa + pc * csa, rsa, csa, mr, bufA.data());
+                        packedBlock = blk;
+                    }
+                    const std::size_t jrBegin = (t % groups) * panelsPerGroup * nr;
+                    const std::size_t jrEnd   = std::min(nc, jrBegin + panelsPerGroup * nr);
+
+                    for (std::size_t jr = jrBegin; jr < jrEnd; jr += nr) {
+                        const std::size_t nb = std::min(nr, nc - jr);
+                        const T* b = packedB + jr * kc;
+                        for (std::size_t ir = 0; ir < mc; ir += mr) {
+                            const std::size_t mb = std::min(mr, mc - ir);
+                            const T* a = bufA.data() + ir * kc;
+                            T* c = C + (ic + ir) * ldc + jc + jr;
+                            if (mb == mr && nb == nr) {
+                                ker.fn(kc, a, b, alpha, c, ldc);
+                            } else {
+                                // Edge tile: compute the full padded tile, keep the valid part.
+                                std::fill(tile, tile + mr * nr, T(0));
+                                ker.fn(kc, a, b, alpha, tile, nr);
+                                for (std::size_t i = 0; i < mb; ++i)
+                                    for (std::size_t j = 0; j < nb; ++j)
+                                        c[i * ldc + j] += tile[i * nr + j];
+                            }
+                        }
+                    }
+                }
+            };
+
+            if (parallel)
+                parallelFor(0, icBlocks * groups, 1, macroKernel);
+            else
+                macroKernel(0, icBlocks * groups);
+        }
+    }
+}
+
+} // namespace
+
+void gemm(Transpose transA, Transpose transB,
+          std::size_t m, std::size_t n, std::size_t k,
+          double alpha, const double* A, std::size_t lda,
+          const double* B, std::size_t ldb,
+          double beta, double* C, std::size_t ldc)
+{
+    gemmImpl(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void gemm(Transpose transA, Transpose transB,
+          std::size_t m, std::size_t n, std::size_t k,
+          float alpha, const float* A, std::size_t lda,
+          const float* B, std::size_t ldb,
+          float beta, float* C, std::size_t ldc)
+{
+    gemmImpl(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void gemm(double alpha, const Matrix& A, const Matrix& B, double beta, Matrix& C) {
+    gemm(Transpose::No, Transpose::No, alpha, A, B, beta, C);
+}
+
+void gemm(Transpose transA, Transpose transB, double alpha,
+          const Matrix& A, const Matrix& B, double beta, Matrix& C)
+{
+    const std::size_t m  = transA == Transpose::No ? A.rows() : A.cols();
+    const std::size_t k  = transA == Transpose::No ? A.cols() : A.rows();
+    const std::size_t kb = transB == Transpose::No ? B.rows() : B.cols();
+    const std::size_t n  = transB == Transpose::No ? B.cols() : B.rows();
+    if (k != kb)
+        throw std::length_error("Matrix inner dimensions must agree");
+    if (C.rows() != m || C.cols() != n)
+        throw std::length_error("Output matrix has wrong shape");
+    if (&C == &A || &C == &B)
+        throw std::invalid_argument("Output matrix must not alias an operand");
+    gemm(transA, transB, m, n, k, alpha, A.data(), A.stride(),
+         B.data(), B.stride(), beta, C.data(), C.stride());
+}
+
+void gram(std::size_t m, std::size_t n, const double* X, std::size_t ldx,
+          const double* y, double beta, double* G, std::size_t ldg, double* g)
+{
+    // G = beta * G (lower triangle only), g = beta * g; beta == 0 never reads.
+    for (std::size_t i = 0; i < n; ++i) {
+        double* gi = G + i * ldg;
+        for (std::size_t j = 0; j <= i; ++j)
+            gi[j] = beta == 0.0 ? 0.0 : beta * gi[j];
+        if (g)
+            g[i] = beta == 0.0 ? 0.0 : beta * g[i];
+    }
+    if (!g)
+        y = nullptr;
+
+    std::size_t blocks = std::min(kGramMaxBlocks, chunkCount(m, kGramRows));
+    blocks = std::min(blocks, std::max<std::size_t>(1, kGramBudget / std::max<std::size_t>(n * n, 1)));
+    if (blocks <= 1) {
+        if (m > 0)
+            gramBlock(0, m, n, X, ldx, y, G, ldg, g);
+    } else {
+        // Block b covers a fixed row range, and partials are summed in block
+        // order, so the result does not depend on the thread count.
+        const std::size_t grain = chunkCount(m, blocks);
+        blocks = chunkCount(m, grain);
+        std::vector<double> partialG(blocks * n * n, 0.0);
+        std::vector<double> partialg(blocks * n, 0.0);
+        parallelFor(0, blocks, 1, [&](std::size_t b0, std::size_t b1) {
+            for (std::size_t b = b0; b < b1; ++b)
+                gramBlock(b * grain, std::min(m, (b + 1) * grain), n, X, ldx, y,
+                          partialG.data() + b * n * n, n, partialg.data() + b * n);
+        });
+        for (std::size_t b = 0; b < blocks; ++b) {
+            const double* pG = partialG.data() + b * n * n;
+            const double* pg = partialg.data() + b * n;
+            for (std::size_t i = 0; i < n; ++i) {
+                double* gi = G + i * ldg;
+                for (std::size_t j = 0; j <= i; ++j)
+                    gi[j] += pG[i * n + j];
+                if (y)
+                    g[i] += pg[i];
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = i + 1; j < n; ++j)
+            G[i * ldg + j] = G[j * ldg + i];
+}
+
+void gram(const Matrix& X, const Vector& y, double beta, Matrix& G, Vector& g) {
+    const std::size_t n = X.cols();
+    if (y.size() != X.rows())
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (G.rows() != n || G.cols() != n)
+        throw std::length_error("Output matrix has wrong shape");
+    if (g.size() != n)
+        throw std::length_error("Output vector has wrong size");
+    if (&G == &X)
+        throw std::invalid_argument("Output matrix must not alias an operand");
+    gram(X.rows(), n, X.data(), X.stride(), y.data(), beta, G.data(), G.stride(), g.data());
+}
+
+void gram(const Matrix& X, const Vector& y, Matrix& G, Vector& g) {
+    gram(X, y, 0.0, G, g);
+}
+
+const char* gemmKernelName() noexcept {
+    return selectKernel<double>().name;
+}
@@ -0,0 +1,183 @@
+// src/ConjugateGradient.cpp
+#include "ConjugateGradient.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Preconditioner::~Preconditioner() = default;
+
+namespace {
+
+void checkApply(const Preconditioner& M, const Vector& r, const Vector& z) {
+    if (r.size() != M.size() || z.size() != M.size())
+        throw std::length_error("Preconditioner size does not match the vectors");
+}
+
+void checkPreconditioner(const Preconditioner* M, std::size_t n) {
+    if (M && M->size() != n)
+        throw std::length_error("Preconditioner size does not match the system");
+}
+
+} // namespace
+
+JacobiPreconditioner::JacobiPreconditioner(const Matrix& A)
+    : mInvDiag(A.rows())
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    for (std::size_t i = 0; i < A.rows(); ++i) {
+        const double d = A.row(i)[i];
+        if (d == 0.0)
+            throw std::invalid_argument("Jacobi preconditioner needs a nonzero diagonal");
+        mInvDiag[i] = 1.0 / d;
+    }
+}
+
+JacobiPreconditioner::JacobiPreconditioner(const Vector& diagonal)
+    : mInvDiag(diagonal.size())
+{
+    for (std::size_t i = 0; i < diagonal.size(); ++i) {
+        if (diagonal[i] == 0.0)
+            throw std::invalid_argument("Jacobi preconditioner needs a nonzero diagonal");
+        mInvDiag[i] = 1.0 / diagonal[i];
+    }
+}
+
+std::size_t JacobiPreconditioner::size() const noexcept { return mInvDiag.size(); }
+
+void JacobiPreconditioner::apply(const Vector& r, Vector& z) const {
+    checkApply(*this, r, z);
+    const double* rp = r.data();
+    const double* d  = mInvDiag.data();
+    double*       zp = z.data();
+    for (std::size_t i = 0; i < mInvDiag.size(); ++i)
+        zp[i] = d[i] * rp[i];
+}
+
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(const Matrix& A)
+    : mL(A.rows(), A.cols())
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    const std::size_t n = A.rows();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* ai = A.row(i);
+        double*       li = mL.row(i);
+        for (std::size_t j = 0; j <= i; ++j) {
+            if (j != i && ai[j] == 0.0)
+                continue;   // outside the pattern: no fill-in
+            const double* lj = mL.row(j);
+            double sum = ai[j];
+            for (std::size_t p = 0; p < j; ++p)
+                sum -= li[p] * lj[p];
+            if (j == i) {
+                if (!(sum > 0.0))
+                    throw std::runtime_error("Incomplete Cholesky breakdown (non-positive pivot)");
+                li[i] = std::sqrt(sum);
+            } else {
+                li[j] = sum / lj[j];
+            }
+        }
+    }
+}
+
+std::size_t IncompleteCholeskyPreconditioner::size() const noexcept { return mL.rows(); }
+
+void IncompleteCholeskyPreconditioner::apply(const Vector& r, Vector& z) const {
+    checkApply(*this, r, z);
+    const std::size_t n = mL.rows();
+    const double* rp = r.data();
+    double*       x  = z.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* li = mL.row(i);
+        double sum = rp[i];
+        for (std::size_t j = 0; j < i; ++j)
+            sum -= li[j] * x[j];
+        x[i] = sum / li[i];
+    }
+    for (std::size_t i = n; i-- > 0;) {
+        const double* li = mL.row(i);
+        x[i] /= li[i];
+        const double xi = x[i];
+        for (std::size_t j = 0; j < i; ++j)
+            x[j] -= li[j] * xi;
+    }
+}
+
+ConjugateGradient::ConjugateGradient(const LinearOperator& A, const CGOptions& options,
+                                     const Preconditioner* preconditioner)
+    : mA(&A), mOptions(options), mPreconditioner(preconditioner),
+      mR(A.rows()), mZ(A.rows()), mP(A.rows()), mAp(A.rows())
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    checkPreconditioner(preconditioner, A.rows());
+}
+
+ConjugateGradient::ConjugateGradient(const Matrix& A, const CGOptions& options,
+                                     const Preconditioner* preconditioner)
+    : mDense(std::make_unique<DenseOperator>(A)), mA(mDense.get()),
+      mOptions(options), mPreconditioner(preconditioner),
+      mR(A.rows()), mZ(A.rows()), mP(A.rows()), mAp(A.rows())
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    checkPreconditioner(preconditioner, A.rows());
+}
+
+CGResult ConjugateGradient::solve(const Vector& b, Vector& x) {
+    const std::size_t n = mA->rows();
+    if (b.size() != n || x.size() != n)
+        throw std::invalid_argument("Size mismatch between A and b");
+
+    CGResult result;
+    const std::size_t maxIter = mOptions.maxIter ? mOptions.maxIter : 10 * n;
+    const double threshold = std::max(mOptions.absTol,
+                                      mOptions.relTol * std::sqrt(b.dot(b)));
+
+    // r = b - A x
+    mA->apply(x, mAp);
+    mR = b;
+    mR -= mAp;
+    result.residualNorm = std::sqrt(mR.dot(mR));
+    if (result.residualNorm <= threshold) {
+        result.converged = true;
+        return result;
+    }
+
+    auto precondition = [this] {
+        if (mPreconditioner)
+            mPreconditioner->apply(mR, mZ);
+        else
+            mZ = mR;   // same size: plain copy, no allocation
+    };
+    precondition();
+    mP = mZ;
+    double rz = mR.dot(mZ);
+
+    for (std::size_t iter = 1; iter <= maxIter; ++iter) {
+        mA->apply(mP, mAp);
+        const double pAp = mP.dot(mAp);
+        if (!(pAp > 0.0))
+            break;   // A (or M) is not positive definite along p
+        const double alpha = rz / pAp;
+        x.axpy(alpha, mP);
+        mR.axpy(-alpha, mAp);
+
+        result.iterations   = iter;
+        result.residualNorm = std::sqrt(mR.dot(mR));
+        if (result.residualNorm <= threshold) {
+            result.converged = true;
+            break;
+        }
+
+        precondition();
+        const double rzNew = mR.dot(mZ);
+        mP.axpby(1.0, mZ, rzNew / rz);
+        rz = rzNew;
+    }
+    return result;
+}
+
+const CGOptions& ConjugateGradient::options() const noexcept { return mOptions; }
+void ConjugateGradient::setOptions(const CGOptions& options) { mOptions = options; }
@@ -0,0 +1,116 @@
+// src/CrossValidation.cpp
+#include "CrossValidation.hpp"
+#include "NormalEquations.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+// Rows gathered per gram call when accumulating a fold.
+constexpr std::size_t kGatherRows = 1024;
+
+MetricSummary summarize(const std::vector<FoldScore>& scores, double FoldScore::*metric) {
+    MetricSummary s;
+    const std::size_t n = scores.size();
+    for (const FoldScore& f : scores)
+        s.mean += f.*metric;
+    s.mean /= double(n);
+    if (n > 1) {
+        for (const FoldScore& f : scores) {
+            const double d = f.*metric - s.mean;
+            s.variance += d * d;
+        }
+        s.variance /= double(n - 1);
+    }
+    return s;
+}
+
+} // namespace
+
+CrossValidationResult crossValidate(MatrixView X, Span<const double> y,
+                                    const CrossValidationOptions& options)
+{
+    const std::size_t n = X.rows(), p = X.cols(), k = options.folds;
+    if (y.size() != n)
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (k < 2 || k > n)
+        throw std::invalid_argument("Number of folds must lie in [2, rows]");
+    if (options.seeds.empty())
+        throw std::invalid_argument("Cross-validation needs at least one seed");
+    const std::size_t seeds = options.seeds.size(), splits = seeds * k;
+
+    // Row order per seed; fold f holds positions [f*n/k, (f+1)*n/k).
+    std::vector<std::vector<std::size_t>> order(seeds, std::vector<std::size_t>(n));
+    for (std::size_t s = 0; s < seeds; ++s) {
+        std::iota(order[s].begin(), order[s].end(), std::size_t(0));
+        std::mt19937 rng(options.seeds[s]);
+        std::shuffle(order[s].begin(), order[s].end(), rng);
+    }
+    auto foldBegin = [&](std::size_t f) { return f * n / k; };
+
+    // Normal equations of every held-out fold.
+    std::vector<NormalEquationAccumulator> parts(splits, NormalEquationAccumulator(p));
+    parallelFor(0, splits, 1, [&](std::size_t begin, std::size_t end) {
+        Matrix bufX(kGatherRows, p);
+        Vector bufY(kGatherRows);
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::vector<std::size_t>& rows = order[t / k];
+            const std::size_t last = foldBegin(t % k + 1);
+            for (std::size_t r = foldBegin(t % k); r < last; r += kGatherRows) {
+                const std::size_t m = std::min(kGatherRows, last - r);
+                for (std::size_t i = 0; i < m; ++i) {
+                    const double* src = X.row(rows[r + i]);
+                    std::copy(src, src + p, bufX.row(i));
+                    bufY[i] = y[rows[r + i]];
+                }
+                parts[t].add(m, bufX.data(), bufX.stride(), bufY.data());
+            }
+        }
+    });
+
+    // Per-seed totals, summed in fold order.
+    std::vector<NormalEquationAccumulator> totals(seeds, NormalEquationAccumulator(p));
+    for (std::size_t t = 0; t < splits; ++t)
+        totals[t / k].merge(parts[t]);
+
+    CrossValidationResult result;
+    result.folds.resize(splits);
+    parallelFor(0, splits, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const std::size_t s = t / k, f = t % k;
+            NormalEquationAccumulator train = totals[s];
+            train.subtract(parts[t]);
+            const Vector beta = train.solve(options.ridge);
+
+            // Held-out rows are scored directly: exact, and only O(n/k · p).
+            double sse = 0.0, sae = 0.0;
+            for (std::size_t r = foldBegin(f); r < foldBegin(f + 1); ++r) {
+                const double* xi = X.row(order[s][r]);
+                double pred = 0.0;
+                for (std::size_t j = 0; j < p; ++j)
+                    pred += xi[j] * beta[j];
+                const double err = pred - y[order[s][r]];
+                sse += err * err;
+                sae += std::abs(err);
+            }
+
+            FoldScore& score = result.folds[t];
+            score.seed      = options.seeds[s];
+            score.fold      = f;
+            score.trainRows = train.count();
+            score.testRows  = parts[t].count();
+            score.trainRmse = std::sqrt(train.residualSumOfSquares(beta) / double(train.count()));
+            score.testRmse  = std::sqrt(sse / double(score.testRows));
+            score.testMae   = sae / double(score.testRows);
+        }
+    });
+
+    result.trainRmse = summarize(result.folds, &FoldScore::trainRmse);
+    result.testRmse  = summarize(result.folds, &FoldScore::testRmse);
+    result.testMae   = summarize(result.folds, &FoldScore::testMae);
+    return result;
+}
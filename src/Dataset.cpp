@@ -0,0 +1,184 @@
+// src/Dataset.cpp
+#include "Dataset.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Inputs are split into line-aligned chunks of about this many bytes.
+constexpr std::size_t kChunkBytes = std::size_t(1) << 20;
+
+void validate(const CsvSchema& schema) {
+    if (std::count(schema.columns.begin(), schema.columns.end(), ColumnRole::Target) != 1)
+        throw std::invalid_argument("CSV schema needs exactly one Target column");
+}
+
+[[noreturn]] void parseError(const std::string& what, std::size_t line) {
+    throw std::runtime_error(what + " at line " + std::to_string(line));
+}
+
+// [begin, end) of the line starting at p; *next receives the following line.
+const char* lineEnd(const char* p, const char* end, const char** next) {
+    const char* nl = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+    *next = nl ? nl + 1 : end;
+    const char* e = nl ? nl : end;
+    if (e > p && e[-1] == '\r')
+        --e;
+    return e;
+}
+
+bool isSpace(char c) { return c == ' ' || c == '\t'; }
+
+// Parse one record into x (schema.features() values) and *y.
+void parseRecord(const char* p, const char* end, const CsvSchema& schema,
+                 double* x, double* y, std::size_t line)
+{
+    const std::size_t expected = schema.columns.size();
+    std::size_t col = 0, f = 0;
+    for (;;) {
+        const char* sep = static_cast<const char*>(
+            std::memchr(p, schema.delimiter, std::size_t(end - p)));
+        const char* fend = sep ? sep : end;
+        if (col >= expected)
+            parseError("Expected " + std::to_string(expected) + " fields", line);
+        const ColumnRole role = schema.columns[col];
+        if (role != ColumnRole::Ignore) {
+            const char* b = p;
+            const char* e = fend;
+            while (b < e && isSpace(*b)) ++b;
+            while (e > b && isSpace(e[-1])) --e;
+            double v = 0.0;
+            const auto res = std::from_chars(b, e, v);
+            if (res.ec != std::errc() || res.ptr != e || b == e)
+                parseError("Cannot parse number '" + std::string(p, fend) +
+                           "' in field " + std::to_string(col + 1), line);
+            if (role == ColumnRole::Feature) x[f++] = v;
+            else                             *y = v;
+        }
+        ++col;
+        if (!sep)
+            break;
+        p = sep + 1;
+    }
+    if (col != expected)
+        parseError("Expected " + std::to_string(expected) + " fields, found " +
+                   std::to_string(col), line);
+    if (schema.intercept)
+        x[f] = 1.0;
+}
+
+// Skip the header line if the schema has one; returns the first data byte.
+const char* skipHeader(const char* p, const char* end, const CsvSchema& schema,
+                       std::size_t* line) {
+    if (schema.header && p < end) {
+        lineEnd(p, end, &p);
+        ++*line;
+    }
+    return p;
+}
+
+} // namespace
+
+std::size_t CsvSchema::features() const noexcept {
+    return std::size_t(std::count(columns.begin(), columns.end(), ColumnRole::Feature)) +
+           (intercept ? 1 : 0);
+}
+
+Dataset parseCsv(std::string_view text, const CsvSchema& schema) {
+    validate(schema);
+    const char* end = text.data() + text.size();
+    std::size_t firstLine = 1;
+    const char* begin = skipHeader(text.data(), end, schema, &firstLine);
+
+    // Chunk c covers [bounds[c], bounds[c+1]), each ending on a line break.
+    std::vector<const char*> bounds{ begin };
+    while (bounds.back() < end) {
+        const char* p = bounds.back() + std::min<std::size_t>(kChunkBytes, std::size_t(end - bounds.back()));
+        if (p < end) {
+            const char* nl = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+            p = nl ? nl + 1 : end;
+        }
+        bounds.push_back(p);
+    }
+    const std::size_t chunks = bounds.size() - 1;
+
+    // Pass 1: records and physical lines per chunk.
+    std::vector<std::size_t> records(chunks + 1, 0), lines(chunks + 1, 0);
+    parallelFor(0, chunks, 1, [&](std::size_t c0, std::size_t c1) {
+        for (std::size_t c = c0; c < c1; ++c) {
+            std::size_t r = 0, l = 0;
+            for (const char* p = bounds[c]; p < bounds[c + 1];) {
+                const char* next;
+                const char* e = lineEnd(p, bounds[c + 1], &next);
+                r += e > p;
+                ++l;
+                p = next;
+            }
+            records[c + 1] = r;
+            lines[c + 1]   = l;
+        }
+    });
+    for (std::size_t c = 0; c < chunks; ++c) {
+        records[c + 1] += records[c];
+        lines[c + 1]   += lines[c];
+    }
+
+    // Pass 2: parse each chunk into its own row range.
+    Dataset data{ Matrix(records[chunks], schema.features()), Vector(records[chunks]) };
+    parallelFor(0, chunks, 1, [&](std::size_t c0, std::size_t c1) {
+        for (std::size_t c = c0; c < c1; ++c) {
+            std::size_t row  = records[c];
+            std::size_t line = firstLine + lines[c];
+            for (const char* p = bounds[c]; p < bounds[c + 1]; ++line) {
+                const char* next;
+                const char* e = lineEnd(p, bounds[c + 1], &next);
+                if (e > p) {
+                    parseRecord(p, e, schema, data.X.row(row), data.y.data() + row, line);
+                    ++row;
+                }
+                p = next;
+            }
+        }
+    });
+    return data;
+}
+
+Dataset readCsv(const std::string& path, const CsvSchema& schema) {
+    validate(schema);
+    MappedFile file(path);
+    return parseCsv(std::string_view(file.data(), file.size()), schema);
+}
+
+CsvReader::CsvReader(const std::string& path, const CsvSchema& schema)
+    : mFile(path), mSchema(schema), mOffset(0), mLine(1)
+{
+    validate(mSchema);
+    const char* begin = mFile.data();
+    mOffset = std::size_t(skipHeader(begin, begin + mFile.size(), mSchema, &mLine) - begin);
+}
+
+std::size_t CsvReader::readChunk(Matrix& X, Vector& y) {
+    if (X.cols() != mSchema.features())
+        throw std::length_error("Chunk matrix has the wrong number of columns");
+    if (y.size() < X.rows())
+        throw std::length_error("Chunk vector is too short");
+    const char* end = mFile.data() + mFile.size();
+    const char* p   = mFile.data() + mOffset;
+    std::size_t rows = 0;
+    while (rows < X.rows() && p < end) {
+        const char* next;
+        const char* e = lineEnd(p, end, &next);
+        if (e > p) {
+            parseRecord(p, e, mSchema, X.row(rows), y.data() + rows, mLine);
+            ++rows;
+        }
+        ++mLine;
+        p = next;
+    }
+    mOffset = std::size_t(p - mFile.data());
+    return rows;
+}
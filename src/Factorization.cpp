@@ -0,0 +1,605 @@
+// src/Factorization.cpp
+#include "Factorization.hpp"
+#include "Blas.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+// QR: diagonal entries below this fraction of the largest are rank loss.
+constexpr double kSingularTol = 1e-12;
+
+// A22 -= L21 · U12: gemm where a kernel exists, plain loops otherwise.
+void trailingUpdate(std::size_t rest, std::size_t kb, const float* L, const float* U, float* A,
+                    std::size_t ld)
+{
+    gemm(Transpose::No, Transpose::No, rest, rest, kb, -1.0f, L, ld, U, ld, 1.0f, A, ld);
+}
+
+void trailingUpdate(std::size_t rest, std::size_t kb, const double* L, const double* U, double* A,
+                    std::size_t ld)
+{
+    gemm(Transpose::No, Transpose::No, rest, rest, kb, -1.0, L, ld, U, ld, 1.0, A, ld);
+}
+
+template <typename T>
+void trailingUpdate(std::size_t rest, std::size_t kb, const T* L, const T* U, T* A, std::size_t ld) {
+    for (std::size_t i = 0; i < rest; ++i) {
+        T* ai = A + i * ld;
+        for (std::size_t p = 0; p < kb; ++p) {
+            const T  l  = L[i * ld + p];
+            const T* up = U + p * ld;
+            for (std::size_t j = 0; j < rest; ++j)
+                ai[j] -= l * up[j];
+        }
+    }
+}
+
+// In-place right-looking blocked LU of the n×n row-major matrix at @p a
+// (leading dimension @p ld). Writes LAPACK-style pivots to @p pivots.
+template <typename T>
+void factorLU(T* a, std::size_t n, std::size_t ld, std::size_t blockSize, std::size_t* pivots) {
+    auto row = [a, ld](std::size_t i) { return a + i * ld; };
+
+    // A pivot at most n·ε times the largest entry of its original column is
+    // rounding noise; relative to the column so that scaling does not matter.
+    std::vector<T> tol(n, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            tol[j] = std::max(tol[j], std::abs(row(i)[j]));
+    const T scale = T(n) * std::numeric_limits<T>::epsilon();
+    for (T& t : tol)
+        t *= scale;
+
+    for (std::size_t k0 = 0; k0 < n; k0 += blockSize) {
+        const std::size_t kend = std::min(k0 + blockSize, n);
+
+        // Panel: unblocked elimination of columns [k0, kend) over rows [k0, n).
+        // Whole rows are swapped, which applies the pivot to L, U and A22 at once.
+        for (std::size_t k = k0; k < kend; ++k) {
+            std::size_t pivot = k;
+            T maxVal = std::abs(row(k)[k]);
+            for (std::size_t i = k + 1; i < n; ++i) {
+                const T val = std::abs(row(i)[k]);
+                if (val > maxVal) {
+                    maxVal = val;
+                    pivot = i;
+                }
+            }
+            if (!(maxVal > tol[k]))   // also rejects zero columns and NaN
+                throw std::runtime_error("Matrix is singular or nearly singular");
+            pivots[k] = pivot;
+            if (pivot != k)
+                std::swap_ranges(row(k), row(k) + n, row(pivot));
+
+            const T* rk = row(k);
+            for (std::size_t i = k + 1; i < n; ++i) {
+                T* ri = row(i);
+                const T l = ri[k] / rk[k];
+                ri[k] = l;
+                for (std::size_t j = k + 1; j < kend; ++j)
+                    ri[j] -= l * rk[j];
+            }
+        }
+        if (kend == n)
+            break;
+
+        // U12 = L11^{-1} A12, row by row so the inner loop is contiguous.
+        for (std::size_t i = k0 + 1; i < kend; ++i) {
+            T* ri = row(i);
+            for (std::size_t p = k0; p < i; ++p) {
+                const T  l  = ri[p];
+                const T* rp = row(p);
+                for (std::size_t j = kend; j < n; ++j)
+                    ri[j] -= l * rp[j];
+            }
+        }
+
+        // A22 -= L21 · U12: the BLAS-3 trailing update.
+        trailingUpdate(n - kend, kend - k0, row(kend) + k0, row(k0) + kend,
+                       row(kend) + kend, ld);
+    }
+}
+
+} // namespace
+
+template <typename T>
+BasicLUFactorization<T>::BasicLUFactorization(const BasicMatrix<T>& A)
+    : mLU(A), mPivots(A.rows())
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    factorLU(mLU.data(), mLU.rows(), mLU.stride(), kBlockSize, mPivots.data());
+}
+
+template <typename T>
+BasicVector<T> BasicLUFactorization<T>::solve(const BasicVector<T>& b) const {
+    BasicVector<T> x(b);
+    solveInPlace(x);
+    return x;
+}
+
+template <typename T>
+void BasicLUFactorization<T>::solveInPlace(BasicVector<T>& b) const {
+    solveInPlace(Span<T>(b.data(), b.size()));
+}
+
+template <typename T>
+void BasicLUFactorization<T>::solveInPlace(Span<T> b) const {
+    const std::size_t n = mLU.rows();
+    if (b.size() != n)
+        throw std::invalid_argument("Size mismatch between A and b");
+    T* x = b.data();
+    for (std::size_t k = 0; k < n; ++k)
+        if (mPivots[k] != k)
+            std::swap(x[k], x[mPivots[k]]);
+    // Forward substitution with unit-lower L.
+    for (std::size_t i = 1; i < n; ++i) {
+        const T* li = mLU.row(i);
+        T sum = x[i];
+        for (std::size_t j = 0; j < i; ++j)
+            sum -= li[j] * x[j];
+        x[i] = sum;
+    }
+    // Back substitution with U.
+    for (std::size_t i = n; i-- > 0;) {
+        const T* ui = mLU.row(i);
+        T sum = x[i];
+        for (std::size_t j = i + 1; j < n; ++j)
+            sum -= ui[j] * x[j];
+        x[i] = sum / ui[i];
+    }
+}
+
+template <typename T>
+T BasicLUFactorization<T>::determinant() const {
+    T det = T(1);
+    for (std::size_t k = 0; k < mLU.rows(); ++k) {
+        det *= mLU.row(k)[k];
+        if (mPivots[k] != k)
+            det = -det;
+    }
+    return det;
+}
+
+template class BasicLUFactorization<float>;
+template class BasicLUFactorization<double>;
+template class BasicLUFactorization<long double>;
+
+LUFactorization::LUFactorization(const Matrix& A)
+    : mLU(BasicMatrix<double>(A))
+{
+}
+
+Vector LUFactorization::solve(const Vector& b) const {
+    Vector x(b);
+    solveInPlace(x);
+    return x;
+}
+
+void LUFactorization::solveInPlace(Vector& b) const {
+    mLU.solveInPlace(Span<double>(b.data(), b.size()));
+}
+
+Matrix LUFactorization::solve(const Matrix& B) const {
+    Matrix X(B);
+    solveInPlace(X);
+    return X;
+}
+
+void LUFactorization::solveInPlace(Matrix& B) const {
+    const BasicMatrix<double>&      lu     = mLU.factors();
+    const std::vector<std::size_t>& pivots = mLU.pivots();
+    const std::size_t n = lu.rows();
+    const std::size_t m = B.cols();
+    if (B.rows() != n)
+        throw std::invalid_argument("Size mismatch between A and b");
+    for (std::size_t k = 0; k < n; ++k)
+        if (pivots[k] != k)
+            std::swap_ranges(B.row(k), B.row(k) + m, B.row(pivots[k]));
+    // Row-oriented substitutions: every update is an axpy over a row of B.
+    for (std::size_t i = 1; i < n; ++i) {
+        const double* li = lu.row(i);
+        double* bi = B.row(i);
+        for (std::size_t p = 0; p < i; ++p) {
+            const double  l  = li[p];
+            const double* bp = B.row(p);
+            for (std::size_t j = 0; j < m; ++j)
+                bi[j] -= l * bp[j];
+        }
+    }
+    for (std::size_t i = n; i-- > 0;) {
+        const double* ui = lu.row(i);
+        double* bi = B.row(i);
+        for (std::size_t p = i + 1; p < n; ++p) {
+            const double  u  = ui[p];
+            const double* bp = B.row(p);
+            for (std::size_t j = 0; j < m; ++j)
+                bi[j] -= u * bp[j];
+        }
+        const double inv = 1.0 / ui[i];
+        for (std::size_t j = 0; j < m; ++j)
+            bi[j] *= inv;
+    }
+}
+
+double LUFactorization::determinant() const { return mLU.determinant(); }
+
+Matrix LUFactorization::inverse() const {
+    const std::size_t n = mLU.size();
+    Matrix inv(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        inv.row(i)[i] = 1.0;
+    solveInPlace(inv);
+    return inv;
+}
+
+const BasicMatrix<double>& LUFactorization::factors() const noexcept { return mLU.factors(); }
+const std::vector<std::size_t>& LUFactorization::pivots() const noexcept { return mLU.pivots(); }
+std::size_t LUFactorization::size() const noexcept { return mLU.size(); }
+
+CholeskyFactorization::CholeskyFactorization(const Matrix& A)
+    : mL(A)
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    const std::size_t n  = A.rows();
+    const std::size_t ld = mL.stride();
+
+    for (std::size_t k0 = 0; k0 < n; k0 += kBlockSize) {
+        const std::size_t kend = std::min(k0 + kBlockSize, n);
+
+        // Diagonal block: unblocked left-looking Cholesky (row-oriented dots).
+        for (std::size_t i = k0; i < kend; ++i) {
+            double* li = mL.row(i);
+            for (std::size_t j = k0; j <= i; ++j) {
+                const double* lj = mL.row(j);
+                double sum = li[j];
+                for (std::size_t p = k0; p < j; ++p)
+                    sum -= li[p] * lj[p];
+                if (j == i) {
+                    if (!(sum > 0.0))
+                        throw std::runtime_error("Matrix is not positive definite");
+                    li[i] = std::sqrt(sum);
+                } else {
+                    li[j] = sum / lj[j];
+                }
+            }
+        }
+        if (kend == n)
+            break;
+
+        // L21 = A21 · L11^{-T}: one forward substitution per row of A21.
+        for (std::size_t i = kend; i < n; ++i) {
+            double* li = mL.row(i);
+            for (std::size_t j = k0; j < kend; ++j) {
+                const double* lj = mL.row(j);
+                double sum = li[j];
+                for (std::size_t p = k0; p < j; ++p)
+                    sum -= li[p] * lj[p];
+                li[j] = sum / lj[j];
+            }
+        }
+
+        // A22 -= L21 · L21ᵀ, one block row at a time up to the diagonal so
+        // only the lower triangle (plus the diagonal blocks) is touched.
+        for (std::size_t i0 = kend; i0 < n; i0 += kBlockSize) {
+            const std::size_t i1 = std::min(i0 + kBlockSize, n);
+            gemm(Transpose::No, Transpose::Yes, i1 - i0, i1 - kend, kend - k0,
+                 -1.0, mL.row(i0) + k0, ld,
+                 mL.row(kend) + k0, ld,
+                 1.0, mL.row(i0) + kend, ld);
+        }
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+        std::fill(mL.row(i) + i + 1, mL.row(i) + n, 0.0);
+}
+
+Vector CholeskyFactorization::solve(const Vector& b) const {
+    Vector x(b);
+    solveInPlace(x);
+    return x;
+}
+
+void CholeskyFactorization::solveInPlace(Vector& b) const {
+    if (b.size() != mL.rows())
+        throw std::invalid_argument("Size mismatch between A and b");
+    const std::size_t n = mL.rows();
+    double* x = b.data();
+    // L y = b
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* li = mL.row(i);
+        double sum = x[i];
+        for (std::size_t j = 0; j < i; ++j)
+            sum -= li[j] * x[j];
+        x[i] = sum / li[i];
+    }
+    // Lᵀ x = y, column-oriented so each update reads a row of L.
+    for (std::size_t i = n; i-- > 0;) {
+        const double* li = mL.row(i);
+        x[i] /= li[i];
+        const double xi = x[i];
+        for (std::size_t j = 0; j < i; ++j)
+            x[j] -= li[j] * xi;
+    }
+}
+
+Matrix CholeskyFactorization::solve(const Matrix& B) const {
+    Matrix X(B);
+    solveInPlace(X);
+    return X;
+}
+
+void CholeskyFactorization::solveInPlace(Matrix& B) const {
+    if (B.rows() != mL.rows())
+        throw std::invalid_argument("Size mismatch between A and b");
+    const std::size_t n = mL.rows();
+    const std::size_t m = B.cols();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* li = mL.row(i);
+        double* bi = B.row(i);
+        for (std::size_t p = 0; p < i; ++p) {
+            const double  l  = li[p];
+            const double* bp = B.row(p);
+            for (std::size_t j = 0; j < m; ++j)
+                bi[j] -= l * bp[j];
+        }
+        const double inv = 1.0 / li[i];
+        for (std::size_t j = 0; j < m; ++j)
+            bi[j] *= inv;
+    }
+    for (std::size_t i = n; i-- > 0;) {
+        const double* li = mL.row(i);
+        double* bi = B.row(i);
+        const double inv = 1.0 / li[i];
+        for (std::size_t j = 0; j < m; ++j)
+            bi[j] *= inv;
+        for (std::size_t p = 0; p < i; ++p) {
+            const double l  = li[p];
+            double*      bp = B.row(p);
+            for (std::size_t j = 0; j < m; ++j)
+                bp[j] -= l * bi[j];
+        }
+    }
+}
+
+const Matrix& CholeskyFactorization::factor() const noexcept { return mL; }
+std::size_t CholeskyFactorization::size() const noexcept { return mL.rows(); }
+
+QRFactorization::QRFactorization(const Matrix& A)
+    : mQR(A), mTau(A.cols())
+{
+    const std::size_t m = A.rows();
+    const std::size_t n = A.cols();
+    if (m < n)
+        throw std::invalid_argument("QR requires rows >= cols");
+
+    std::vector<double> w(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        auto col = mQR.colView(k);
+
+        // Householder vector for column k: v = x - alpha e_k, scaled so v[k] = 1.
+        double norm2 = 0.0;
+        for (std::size_t i = k; i < m; ++i)
+            norm2 += col[i] * col[i];
+        const double norm = std::sqrt(norm2);
+        if (norm == 0.0)
+            throw std::runtime_error("Matrix is rank deficient");
+        const double x0    = col[k];
+        const double alpha = x0 > 0.0 ? -norm : norm;
+        const double v0    = x0 - alpha;
+        for (std::size_t i = k + 1; i < m; ++i)
+            col[i] /= v0;
+        const double tau = -v0 / alpha;
+        col[k]  = alpha;
+        mTau[k] = tau;
+
+        // Trailing columns: w = vᵀ A, then A -= tau v wᵀ, both streaming rows.
+        const std::size_t c0 = k + 1;
+        if (c0 == n)
+            continue;
+        const double* rk = mQR.row(k);
+        std::copy(rk + c0, rk + n, w.begin() + c0);
+        for (std::size_t i = k + 1; i < m; ++i) {
+            const double* ri = mQR.row(i);
+            const double  vi = ri[k];
+            for (std::size_t j = c0; j < n; ++j)
+                w[j] += vi * ri[j];
+        }
+        for (std::size_t j = c0; j < n; ++j)
+            w[j] *= tau;
+        double* rkw = mQR.row(k);
+        for (std::size_t j = c0; j < n; ++j)
+            rkw[j] -= w[j];
+        for (std::size_t i = k + 1; i < m; ++i) {
+            double*      ri = mQR.row(i);
+            const double vi = ri[k];
+            for (std::size_t j = c0; j < n; ++j)
+                ri[j] -= vi * w[j];
+        }
+    }
+
+    // Relative rank test on the diagonal of R.
+    double rmax = 0.0;
+    for (std::size_t k = 0; k < n; ++k)
+        rmax = std::max(rmax, std::abs(mQR.row(k)[k]));
+    for (std::size_t k = 0; k < n; ++k)
+        if (std::abs(mQR.row(k)[k]) <= kSingularTol * rmax)
+            throw std::runtime_error("Matrix is rank deficient");
+}
+
+void QRFactorization::applyQt(Vector& b) const {
+    const std::size_t m = mQR.rows();
+    const std::size_t n = mQR.cols();
+    if (b.size() != m)
+        throw std::invalid_argument("Size mismatch between A and b");
+    double* y = b.data();
+    for (std::size_t k = 0; k < n; ++k) {
+        auto v = mQR.colView(k);
+        double dot = y[k];
+        for (std::size_t i = k + 1; i < m; ++i)
+            dot += v[i] * y[i];
+        dot *= mTau[k];
+        y[k] -= dot;
+        for (std::size_t i = k + 1; i < m; ++i)
+            y[i] -= dot * v[i];
+    }
+}
+
+Vector QRFactorization::solve(const Vector& b) const {
+    const std::size_t n = mQR.cols();
+    Vector y(b);
+    applyQt(y);
+    Vector x(n);
+    double* xp = x.data();
+    const double* yp = y.data();
+    for (std::size_t i = n; i-- > 0;) {
+        const double* ri = mQR.row(i);
+        double sum = yp[i];
+        for (std::size_t j = i + 1; j < n; ++j)
+            sum -= ri[j] * xp[j];
+        xp[i] = sum / ri[i];
+    }
+    return x;
+}
+
+Matrix QRFactorization::R() const {
+    const std::size_t n = mQR.cols();
+    Matrix R(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        std::copy(mQR.row(i) + i, mQR.row(i) + n, R.row(i) + i);
+    return R;
+}
+
+std::size_t QRFactorization::rows() const noexcept { return mQR.rows(); }
+std::size_t QRFactorization::cols() const noexcept { return mQR.cols(); }
+
+SVDFactorization::SVDFactorization(const Matrix& A)
+    : mU(0, 0), mV(0, 0), mS(0)
+{
+    // Decompose op(A) = A, or Aᵀ when A is wide, so that op(A) is m×n, m >= n.
+    const bool wide = A.rows() < A.cols();
+    const std::size_t m = wide ? A.cols() : A.rows();
+    const std::size_t n = wide ? A.rows() : A.cols();
+
+    // Row j of W is column j of op(A); row j of Vt is column j of V.
+    Matrix W(n, m);
+    if (wide) {
+        W = A;
+    } else {
+        for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+                W.row(j)[i] = A.row(i)[j];
+    }
+    Matrix Vt(n, n);
+    for (std::size_t j = 0; j < n; ++j)
+        Vt.row(j)[j] = 1.0;
+
+    const double eps = std::numeric_limits<double>::epsilon();
+    const int maxSweeps = 60;
+    auto rotate = [](double* x, double* y, std::size_t len, double c, double s) {
+        for (std::size_t i = 0; i < len; ++i) {
+            const double xi = x[i], yi = y[i];
+            x[i] = c * xi - s * yi;
+            y[i] = s * xi + c * yi;
+        }
+    };
+    for (int sweep = 0; sweep < maxSweeps; ++sweep) {
+        bool rotated = false;
+        for (std::size_t p = 0; p + 1 < n; ++p) {
+            for (std::size_t q = p + 1; q < n; ++q) {
+                double* wp = W.row(p);
+                double* wq = W.row(q);
+                double alpha = 0.0, beta = 0.0, gamma = 0.0;
+                for (std::size_t i = 0; i < m; ++i) {
+                    alpha += wp[i] * wp[i];
+                    beta  += wq[i] * wq[i];
+                    gamma += wp[i] * wq[i];
+                }
+                if (gamma == 0.0 || std::abs(gamma) <= eps * std::sqrt(alpha * beta))
+                    continue;
+                rotated = true;
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = (zeta >= 0.0 ? 1.0 : -1.0)
+                               / (std::abs(zeta) + std::sqrt(1.0 + zeta * zeta));
+                const double c = 1.0 / std::sqrt(1.0 + t * t);
+                const double s = c * t;
+                rotate(wp, wq, m, c, s);
+                rotate(Vt.row(p), Vt.row(q), n, c, s);
+            }
+        }
+        if (!rotated)
+            break;
+    }
+
+    // Singular values are the column norms; order them descending.
+    std::vector<double> norms(n);
+    for (std::size_t j = 0; j < n; ++j) {
+        const double* wj = W.row(j);
+        double sum = 0.0;
+        for (std::size_t i = 0; i < m; ++i)
+            sum += wj[i] * wj[i];
+        norms[j] = std::sqrt(sum);
+    }
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) { return norms[a] > norms[b]; });
+
+    Matrix Uop(m, n), Vop(n, n);
+    mS = Vector(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t j = order[k];
+        const double sigma = norms[j];
+        mS[k] = sigma;
+        const double inv = sigma > 0.0 ? 1.0 / sigma : 0.0;
+        const double* wj = W.row(j);
+        for (std::size_t i = 0; i < m; ++i)
+            Uop.row(i)[k] = wj[i] * inv;
+        const double* vj = Vt.row(j);
+        for (std::size_t i = 0; i < n; ++i)
+            Vop.row(i)[k] = vj[i];
+    }
+    // A = U S Vᵀ, or for wide A: Aᵀ = Uop S Vopᵀ  =>  A = Vop S Uopᵀ.
+    mU = wide ? std::move(Vop) : std::move(Uop);
+    mV = wide ? std::move(Uop) : std::move(Vop);
+}
+
+const Matrix& SVDFactorization::U() const noexcept { return mU; }
+const Matrix& SVDFactorization::V() const noexcept { return mV; }
+const Vector& SVDFactorization::singularValues() const noexcept { return mS; }
+
+double SVDFactorization::defaultTolerance() const noexcept {
+    const double smax = mS.size() ? mS.data()[0] : 0.0;
+    return double(std::max(mU.rows(), mV.rows()))
+         * std::numeric_limits<double>::epsilon() * smax;
+}
+
+std::size_t SVDFactorization::rank(double tol) const {
+    if (tol < 0.0)
+        tol = defaultTolerance();
+    std::size_t r = 0;
+    while (r < mS.size() && mS[r] > tol)
+        ++r;
+    return r;
+}
+
+Matrix SVDFactorization::pseudoInverse(double tol) const {
+    const std::size_t r = rank(tol);
+    const std::size_t m = mU.rows();
+    const std::size_t n = mV.rows();
+    // A⁺ = V_r · diag(1/s_r) · U_rᵀ: scale the kept columns of V, then one gemm.
+    Matrix Vs(n, r), Ur(m, r);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t k = 0; k < r; ++k)
+            Vs.row(i)[k] = mV.row(i)[k] / mS[k];
+    for (std::size_t i = 0; i < m; ++i)
+        std::copy(mU.row(i), mU.row(i) + r, Ur.row(i));
+    Matrix pinv(n, m);
+    gemm(Transpose::No, Transpose::Yes, 1.0, Vs, Ur, 0.0, pinv);
+    return pinv;
+}
@@ -0,0 +1,173 @@
+// src/LinearModel.cpp
+#include "LinearModel.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// out[r] = intercept + w · X.row(first + r), four rows at a time so the
+// dot products overlap; each row is still summed in feature order, which
+// keeps batch results bit-identical to predict(row).
+void predictRows(const MatrixView& X, std::size_t first, std::size_t count,
+                 const double* w, double intercept, double* out) noexcept
+{
+    const std::size_t p = X.cols();
+    std::size_t r = 0;
+    for (; r + 4 <= count; r += 4) {
+        const double* x0 = X.row(first + r);
+        const double* x1 = X.row(first + r + 1);
+        const double* x2 = X.row(first + r + 2);
+        const double* x3 = X.row(first + r + 3);
+        double a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;
+        for (std::size_t j = 0; j < p; ++j) {
+            a0 += x0[j] * w[j];
+            a1 += x1[j] * w[j];
+            a2 += x2[j] * w[j];
+            a3 += x3[j] * w[j];
+        }
+        out[r]     = a0 + intercept;
+        out[r + 1] = a1 + intercept;
+        out[r + 2] = a2 + intercept;
+        out[r + 3] = a3 + intercept;
+    }
+    for (; r < count; ++r) {
+        const double* x = X.row(first + r);
+        double a = 0.0;
+        for (std::size_t j = 0; j < p; ++j)
+            a += x[j] * w[j];
+        out[r] = a + intercept;
+    }
+}
+
+// Error sums and the target's mean / centred sum of squares over a block.
+struct BlockMetrics {
+    std::size_t count = 0;
+    double      sse   = 0.0;
+    double      sae   = 0.0;
+    double      mean  = 0.0;
+    double      m2    = 0.0;
+
+    // Chan et al. pairwise update for the mean and centred sum of squares.
+    void merge(const BlockMetrics& o) noexcept {
+        if (o.count == 0)
+            return;
+        const double n     = double(count + o.count);
+        const double delta = o.mean - mean;
+        m2   += o.m2 + delta * delta * double(count) * double(o.count) / n;
+        mean += delta * double(o.count) / n;
+        count += o.count;
+        sse   += o.sse;
+        sae   += o.sae;
+    }
+};
+
+} // namespace
+
+LinearModel::LinearModel(const Vector& coefficients, double intercept)
+    : mWeights(coefficients), mIntercept(intercept)
+{
+}
+
+LinearModel::LinearModel(const Vector& coefficients, double intercept,
+                         const Vector& means, const Vector& scales)
+    : mWeights(coefficients.size()), mIntercept(intercept)
+{
+    if (means.size() != coefficients.size() || scales.size() != coefficients.size())
+        throw std::length_error("Coefficient, mean and scale vectors must have equal length");
+    for (std::size_t j = 0; j < coefficients.size(); ++j) {
+        if (scales[j] == 0.0)
+            throw std::invalid_argument("Feature scale must be non-zero");
+        mWeights[j] = coefficients[j] / scales[j];
+        mIntercept -= mWeights[j] * means[j];
+    }
+}
+
+std::size_t LinearModel::features() const noexcept { return mWeights.size(); }
+const Vector& LinearModel::weights() const noexcept { return mWeights; }
+double LinearModel::intercept() const noexcept { return mIntercept; }
+
+double LinearModel::predict(const double* row) const noexcept {
+    const double* w = mWeights.data();
+    double a = 0.0;
+    for (std::size_t j = 0; j < mWeights.size(); ++j)
+        a += row[j] * w[j];
+    return a + mIntercept;
+}
+
+double LinearModel::predict(Span<const double> row) const {
+    if (row.size() != mWeights.size())
+        throw std::length_error("Row length does not match the model");
+    return predict(row.data());
+}
+
+void LinearModel::checkBatch(const MatrixView& X, std::size_t outputs) const {
+    if (X.cols() != mWeights.size())
+        throw std::length_error("Matrix columns do not match the model");
+    if (outputs != X.rows())
+        throw std::length_error("Output length must equal the number of rows");
+}
+
+void LinearModel::predict(MatrixView X, Span<double> out) const {
+    checkBatch(X, out.size());
+    parallelFor(0, X.rows(), Matrix::rowGrain(X.cols()), [&](std::size_t r0, std::size_t r1) {
+        predictRows(X, r0, r1 - r0, mWeights.data(), mIntercept, out.data() + r0);
+    });
+}
+
+Vector LinearModel::predict(MatrixView X) const {
+    Vector out(X.rows());
+    predict(X, Span<double>(out.data(), out.size()));
+    return out;
+}
+
+RegressionMetrics LinearModel::evaluate(MatrixView X, Span<const double> y) const {
+    checkBatch(X, y.size());
+    const std::size_t m = X.rows();
+    if (m == 0)
+        throw std::invalid_argument("No rows to evaluate");
+
+    constexpr std::size_t kTile = 64;  // predictions kept on the stack
+    const std::size_t grain = Matrix::rowGrain(X.cols());
+    std::vector<BlockMetrics> blocks(chunkCount(m, grain));
+    parallelFor(0, m, grain, [&](std::size_t r0, std::size_t r1) {
+        BlockMetrics& b = blocks[r0 / grain];
+        double pred[kTile];
+        double sumY = 0.0;
+        for (std::size_t t = r0; t < r1; t += kTile) {
+            const std::size_t count = std::min(kTile, r1 - t);
+            predictRows(X, t, count, mWeights.data(), mIntercept, pred);
+            for (std::size_t i = 0; i < count; ++i) {
+                const double err = pred[i] - y[t + i];
+                b.sse += err * err;
+                b.sae += std::abs(err);
+                sumY  += y[t + i];
+            }
+        }
+        // The block's targets are still in cache: centre them exactly.
+        b.count = r1 - r0;
+        b.mean  = sumY / double(b.count);
+        for (std::size_t i = r0; i < r1; ++i)
+            b.m2 += (y[i] - b.mean) * (y[i] - b.mean);
+    });
+
+    BlockMetrics total = blocks[0];
+    for (std::size_t k = 1; k < blocks.size(); ++k)
+        total.merge(blocks[k]);
+
+    RegressionMetrics metrics;
+    metrics.count = m;
+    metrics.rmse  = std::sqrt(total.sse / double(m));
+    metrics.mae   = total.sae / double(m);
+    if (total.m2 > 0.0)
+        metrics.r2 = 1.0 - total.sse / total.m2;
+    else
+        metrics.r2 = total.sse == 0.0 ? 1.0 : 0.0;
+    return metrics;
+}
+
+RegressionMetrics LinearModel::evaluate(MatrixView X, const Vector& y) const {
+    return evaluate(X, Span<const double>(y.data(), y.size()));
+}
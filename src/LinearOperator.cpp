@@ -0,0 +1,49 @@
+// src/LinearOperator.cpp
+#include "LinearOperator.hpp"
+#include <stdexcept>
+
+LinearOperator::~LinearOperator() = default;
+
+void LinearOperator::applyTranspose(const Vector&, Vector&) const {
+    throw std::logic_error("Operator does not support transposed application");
+}
+
+DenseOperator::DenseOperator(const Matrix& A) noexcept : mA(A) {}
+
+std::size_t DenseOperator::rows() const noexcept { return mA.rows(); }
+std::size_t DenseOperator::cols() const noexcept { return mA.cols(); }
+
+void DenseOperator::apply(const Vector& x, Vector& y) const {
+    mA.multiply(x, y);
+}
+
+void DenseOperator::applyTranspose(const Vector& x, Vector& y) const {
+    mA.transposeMultiply(x, y, mScratch);
+}
+
+NormalOperator::NormalOperator(const LinearOperator& X, double ridge)
+    : mX(X), mRidge(ridge), mXp(X.rows())
+{
+    if (ridge < 0.0)
+        throw std::invalid_argument("Ridge parameter must be non-negative");
+}
+
+std::size_t NormalOperator::rows() const noexcept { return mX.cols(); }
+std::size_t NormalOperator::cols() const noexcept { return mX.cols(); }
+
+void NormalOperator::apply(const Vector& x, Vector& y) const {
+    mX.apply(x, mXp);
+    mX.applyTranspose(mXp, y);
+    if (mRidge != 0.0)
+        y.axpy(mRidge, x);
+}
+
+void NormalOperator::applyTranspose(const Vector& x, Vector& y) const {
+    apply(x, y);
+}
+
+Vector NormalOperator::rhs(const Vector& y) const {
+    Vector b(mX.cols());
+    mX.applyTranspose(y, b);
+    return b;
+}
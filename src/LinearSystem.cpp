@@ -1,9 +1,23 @@
 // src/LinearSystem.cpp
 #include "LinearSystem.hpp"
+#include "Factorization.hpp"
 #include <cmath>
+#include <limits>
+#include <optional>
 #include <stdexcept>
 #include <algorithm>
 
+namespace {
+
+double normInf(const Vector& v) {
+    double m = 0.0;
+    for (double x : v)
+        m = std::max(m, std::abs(x));
+    return m;
+}
+
+} // namespace
+
 // Constructor: copy A and b with dimension checks
 LinearSystem::LinearSystem(const Matrix& A, const Vector& b)
     : mSize(b.size()), mA(A), mb(b)
@@ -14,105 +28,168 @@ LinearSystem::LinearSystem(const Matrix& A, const Vector& b)
         throw std::invalid_argument("Size mismatch between A and b");
 }
 
+LinearSystem::LinearSystem(const Matrix& A, const Vector& b, RectangularTag)
+    : mSize(b.size()), mA(A), mb(b)
+{
+    if (A.rows() != b.size())
+        throw std::invalid_argument("Size mismatch between A and b");
+}
+
+LinearSystem::LinearSystem(const Vector& b, OperatorTag)
+    : mSize(b.size()), mA(0, 0), mb(b)
+{
+}
+
 LinearSystem::~LinearSystem() = default;
 
-// Gaussian elimination with partial pivoting
+// Gaussian elimination with partial pivoting (blocked LU, see LUFactorization)
 Vector LinearSystem::Solve() const {
-    std::size_t n = mSize;
-    // Make local copies
-    Matrix A = mA;
-    Vector b = mb;
-
-    // Forward elimination
-    for (std::size_t k = 1; k <= n; ++k) {
-        // Find pivot row
-        std::size_t pivot = k;
-        double maxVal = std::abs(A(k, k));
-        for (std::size_t i = k + 1; i <= n; ++i) {
-            double val = std::abs(A(i, k));
-            if (val > maxVal) {
-                maxVal = val;
-                pivot = i;
-            }
-        }
-        if (maxVal < 1e-12)
-            throw std::runtime_error("Matrix is singular or nearly singular");
-
-        // Swap rows in A and entries in b
-        if (pivot != k) {
-            for (std::size_t j = k; j <= n; ++j)
-                std::swap(A(k, j), A(pivot, j));
-            std::swap(b[k-1], b[pivot-1]);
-        }
-
-        // Eliminate below
-        for (std::size_t i = k + 1; i <= n; ++i) {
-            double factor = A(i, k) / A(k, k);
-            for (std::size_t j = k; j <= n; ++j)
-                A(i, j) -= factor * A(k, j);
-            b[i-1] -= factor * b[k-1];
-        }
-    }
+    return LUFactorization(mA).solve(mb);
+}
 
-    // Back substitution
-    Vector x(n);
-    for (int i = int(n); i >= 1; --i) {
-        double sum = b[i-1];
-        for (std::size_t j = i + 1; j <= n; ++j)
-            sum -= A(i, j) * x[j-1];
-        x[i-1] = sum / A(i, i);
-    }
+PosSymLinSystem::PosSymLinSystem(const Matrix& A, const Vector& b,
+                                 const CGOptions& options,
+                                 const Preconditioner* preconditioner)
+    : LinearSystem(A, b), mOptions(options), mPreconditioner(preconditioner)
+{
+}
 
-    return x;
+PosSymLinSystem::PosSymLinSystem(const LinearOperator& A, const Vector& b,
+                                 const CGOptions& options,
+                                 const Preconditioner* preconditioner)
+    : LinearSystem(b, OperatorTag{}), mOptions(options),
+      mPreconditioner(preconditioner), mOperator(&A)
+{
+    if (A.rows() != A.cols())
+        throw std::invalid_argument("Matrix A must be square");
+    if (A.rows() != b.size())
+        throw std::invalid_argument("Size mismatch between A and b");
 }
 
 // Conjugate Gradient for symmetric positive-definite systems
 Vector PosSymLinSystem::Solve() const {
-    std::size_t n = mSize;
-    Vector x(n);           // initial guess = zero
-    Vector r = mb;         // residual b - A*x = b
-    Vector p = r;          // search direction
-    double rsold = 0.0;
-    for (std::size_t i = 0; i < n; ++i)
-        rsold += r[i] * r[i];
-
-    const double tol = 1e-6;
-    const std::size_t maxIter = std::min(n, static_cast<std::size_t>(1000));
-
-    for (std::size_t iter = 0; iter < maxIter; ++iter) {
-        // Compute A*p
-        Vector Ap(n);
-        for (std::size_t i = 1; i <= n; ++i) {
-            double dot = 0.0;
-            for (std::size_t j = 1; j <= n; ++j)
-                dot += mA(i, j) * p[j-1];
-            Ap[i-1] = dot;
-        }
+    Vector x(mSize);       // initial guess = zero
+    Solve(x);
+    return x;
+}
 
-        // alpha = (rᵀr) / (pᵀAp)
-        double pAp = 0.0;
-        for (std::size_t i = 0; i < n; ++i)
-            pAp += p[i] * Ap[i];
-        double alpha = rsold / pAp;
+CGResult PosSymLinSystem::Solve(Vector& x) const {
+    if (mOperator)
+        return ConjugateGradient(*mOperator, mOptions, mPreconditioner).solve(mb, x);
+    return ConjugateGradient(mA, mOptions, mPreconditioner).solve(mb, x);
+}
+
+const CGOptions& PosSymLinSystem::options() const noexcept { return mOptions; }
+void PosSymLinSystem::setOptions(const CGOptions& options) { mOptions = options; }
+void PosSymLinSystem::setPreconditioner(const Preconditioner* preconditioner) noexcept {
+    mPreconditioner = preconditioner;
+}
+
+// Cholesky factorization for symmetric positive-definite systems
+Vector CholeskySystem::Solve() const {
+    return CholeskyFactorization(mA).solve(mb);
+}
 
-        // Update x and r
-        for (std::size_t i = 0; i < n; ++i) {
-            x[i] += alpha * p[i];
-            r[i] -= alpha * Ap[i];
+LeastSquaresSystem::LeastSquaresSystem(const Matrix& A, const Vector& b)
+    : LinearSystem(A, b, RectangularTag{})
+{
+    if (A.rows() < A.cols())
+        throw std::invalid_argument("Least squares needs at least as many rows as columns");
+}
+
+// Householder QR on the (tall) design matrix
+Vector LeastSquaresSystem::Solve() const {
+    return QRFactorization(mA).solve(mb);
+}
+
+MixedPrecisionSystem::MixedPrecisionSystem(const Matrix& A, const Vector& b,
+                                           const RefinementOptions& options)
+    : LinearSystem(A, b), mOptions(options)
+{
+}
+
+Vector MixedPrecisionSystem::Solve() const {
+    Vector x(mSize);
+    Solve(x);
+    return x;
+}
+
+// Float32 LU plus double-precision iterative refinement (cf. LAPACK dsgesv)
+RefinementResult MixedPrecisionSystem::Solve(Vector& x) const {
+    const std::size_t n = mSize;
+    if (x.size() != n)
+        x = Vector(n);
+    std::fill(x.begin(), x.end(), 0.0);
+
+    double anorm = 0.0, amax = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double rowSum = 0.0;
+        for (double a : mA.rowView(i)) {
+            rowSum += std::abs(a);
+            amax = std::max(amax, std::abs(a));
         }
+        anorm = std::max(anorm, rowSum);
+    }
+    // Entries beyond the float range would round to infinity.
+    if (!(amax <= std::numeric_limits<float>::max()))
+        return fallBack(x, 0);
+
+    std::optional<BasicLUFactorization<float>> lu;
+    try {
+        lu.emplace(FloatMatrix(mA));
+    } catch (const std::runtime_error&) {
+        return fallBack(x, 0);
+    }
 
-        // Check convergence
-        double rsnew = 0.0;
-        for (std::size_t i = 0; i < n; ++i)
-            rsnew += r[i] * r[i];
-        if (std::sqrt(rsnew) < tol)
+    const double threshold = std::sqrt(static_cast<double>(n))
+                           * std::numeric_limits<double>::epsilon() * anorm;
+    RefinementResult result;
+    FloatVector d(n);
+    Vector r(mb);
+    double rnorm = normInf(r);
+    double previous = std::numeric_limits<double>::infinity();
+    for (;;) {
+        result.residualNorm = rnorm;
+        if (rnorm <= threshold * normInf(x)) {
+            result.converged = true;
+            return result;
+        }
+        // Stop when out of iterations or once the residual stops shrinking
+        // (A too ill-conditioned for float factors; also catches NaN).
+        if (result.iterations == mOptions.maxIterations || !(rnorm < previous))
             break;
+        previous = rnorm;
+
+        // Solve A d = r / ||r|| in float; the scaling keeps r in float range.
+        const double scale = rnorm;
+        for (std::size_t i = 0; i < n; ++i)
+            d.data()[i] = static_cast<float>(r.data()[i] / scale);
+        lu->solveInPlace(d);
+        for (std::size_t i = 0; i < n; ++i)
+            x.data()[i] += scale * static_cast<double>(d.data()[i]);
+        ++result.iterations;
 
-        // Update direction
+        mA.multiply(x, r);
         for (std::size_t i = 0; i < n; ++i)
-            p[i] = r[i] + (rsnew / rsold) * p[i];
-        rsold = rsnew;
+            r.data()[i] = mb.data()[i] - r.data()[i];
+        rnorm = normInf(r);
     }
+    return fallBack(x, result.iterations);
+}
 
-    return x;
+RefinementResult MixedPrecisionSystem::fallBack(Vector& x, std::size_t iterations) const {
+    x = LUFactorization(mA).solve(mb);
+    Vector r(mSize);
+    mA.multiply(x, r);
+    for (std::size_t i = 0; i < mSize; ++i)
+        r.data()[i] = mb.data()[i] - r.data()[i];
+
+    RefinementResult result;
+    result.iterations   = iterations;
+    result.residualNorm = normInf(r);
+    result.fellBack     = true;
+    return result;
 }
+
+const RefinementOptions& MixedPrecisionSystem::options() const noexcept { return mOptions; }
+void MixedPrecisionSystem::setOptions(const RefinementOptions& options) { mOptions = options; }
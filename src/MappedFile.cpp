@@ -0,0 +1,95 @@
+// src/MappedFile.cpp
+#include "MappedFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LINALG_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define LINALG_HAVE_MMAP 0
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace {
+
+[[noreturn]] void fail(const std::string& what, const std::string& path) {
+    throw std::runtime_error(what + ": " + path + " (" + std::strerror(errno) + ")");
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string& path)
+    : mData(nullptr), mSize(0)
+{
+#if LINALG_HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        fail("Cannot open file", path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        fail("Cannot stat file", path);
+    }
+    mSize = static_cast<std::size_t>(st.st_size);
+    if (mSize > 0) {
+        void* p = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            fail("Cannot map file", path);
+        }
+        ::madvise(p, mSize, MADV_SEQUENTIAL);
+        mData = static_cast<const char*>(p);
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        fail("Cannot open file", path);
+    mFallback.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    mSize = mFallback.size();
+    mData = mSize ? mFallback.data() : nullptr;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : mData(other.mData), mSize(other.mSize), mFallback(std::move(other.mFallback))
+{
+    other.mData = nullptr;
+    other.mSize = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        mData = other.mData;
+        mSize = other.mSize;
+        mFallback = std::move(other.mFallback);
+        other.mData = nullptr;
+        other.mSize = 0;
+    }
+    return *this;
+}
+
+void MappedFile::release() noexcept {
+#if LINALG_HAVE_MMAP
+    if (mData)
+        ::munmap(const_cast<char*>(mData), mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+    mFallback.clear();
+}
+
+const char* MappedFile::data() const noexcept { return mData; }
+std::size_t MappedFile::size() const noexcept { return mSize; }
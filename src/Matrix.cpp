@@ -1,83 +1,247 @@
 #include "Matrix.hpp"
+#include "Blas.hpp"
+#include "Factorization.hpp"
+#include "ThreadPool.hpp"
 #include <algorithm>
+#include <vector>
+
+namespace {
+
+double* allocate(MemoryResource* resource, std::size_t count) {
+    return static_cast<double*>(resource->allocate(count * sizeof(double), Matrix::kAlignment));
+}
+
+void deallocate(MemoryResource* resource, double* p, std::size_t count) noexcept {
+    if (p)
+        resource->deallocate(p, count * sizeof(double), Matrix::kAlignment);
+}
+
+} // namespace
+
+std::size_t Matrix::rowGrain(std::size_t cols) noexcept {
+    return std::max<std::size_t>(1, kElementGrain / std::max<std::size_t>(cols, 1));
+}
 
 Matrix::Matrix(std::size_t rows, std::size_t cols)
-    : mRows(rows), mCols(cols),
-      mData(new double*[rows])
+    : Matrix(rows, cols, Uninitialized{})
+{
+    std::fill(mData, mData + mRows * mStride, 0.0);
+}
+
+Matrix::Matrix(std::size_t rows, std::size_t cols, Uninitialized)
+    : mRows(rows), mCols(cols), mStride(cols),
+      mResource(currentResource()), mData(allocate(mResource, rows * cols))
 {
-    for (std::size_t i = 0; i < rows; ++i) {
-        mData[i] = new double[cols]();
-    }
 }
 
 Matrix::Matrix(const Matrix& other)
-    : mRows(other.mRows), mCols(other.mCols),
-      mData(new double*[other.mRows])
+    : Matrix(other.mRows, other.mCols, Uninitialized{})
 {
-    for (std::size_t i = 0; i < mRows; ++i) {
-        mData[i] = new double[mCols];
-        std::copy(other.mData[i], other.mData[i] + mCols, mData[i]);
-    }
+    for (std::size_t i = 0; i < mRows; ++i)
+        std::copy(other.row(i), other.row(i) + mCols, row(i));
+}
+
+Matrix::Matrix(Matrix&& other) noexcept
+    : mRows(other.mRows), mCols(other.mCols), mStride(other.mStride),
+      mResource(other.mResource), mData(other.mData)
+{
+    other.mRows = other.mCols = other.mStride = 0;
+    other.mData = nullptr;
 }
 
 Matrix::~Matrix() {
-    for (std::size_t i = 0; i < mRows; ++i)
-        delete[] mData[i];
-    delete[] mData;
+    deallocate(mResource, mData, mRows * mStride);
 }
 
+// Like std::pmr containers, assignment keeps this matrix's resource.
 Matrix& Matrix::operator=(const Matrix& other) {
     if (this != &other) {
-        Matrix tmp(other);
-        std::swap(mRows, tmp.mRows);
-        std::swap(mCols, tmp.mCols);
-        std::swap(mData, tmp.mData);
+        if (mRows * mStride != other.mRows * other.mCols) {
+            double* data = allocate(mResource, other.mRows * other.mCols);
+            deallocate(mResource, mData, mRows * mStride);
+            mData = data;
+        }
+        mRows   = other.mRows;
+        mCols   = other.mCols;
+        mStride = other.mCols;
+        for (std::size_t i = 0; i < mRows; ++i)
+            std::copy(other.row(i), other.row(i) + mCols, row(i));
+    }
+    return *this;
+}
+
+Matrix& Matrix::operator=(Matrix&& other) {
+    // A buffer from another resource may not outlive it (an arena scope).
+    if (mResource != other.mResource)
+        return *this = other;
+    if (this != &other) {
+        deallocate(mResource, mData, mRows * mStride);
+        mRows   = other.mRows;
+        mCols   = other.mCols;
+        mStride = other.mStride;
+        mData   = other.mData;
+        other.mRows = other.mCols = other.mStride = 0;
+        other.mData = nullptr;
     }
     return *this;
 }
 
-double& Matrix::operator()(std::size_t i, std::size_t j) {
-    if (i == 0 || i > mRows || j == 0 || j > mCols)
-        throw std::out_of_range("Matrix 1-based index out of range");
-    return mData[i - 1][j - 1];
+MemoryResource* Matrix::resource() const noexcept { return mResource; }
+
+Matrix Matrix::operator*(const Matrix& rhs) const {
+    Matrix out(mRows, rhs.mCols);
+    multiply(rhs, out);
+    return out;
+}
+
+void Matrix::multiply(const Matrix& rhs, Matrix& out) const {
+    gemm(1.0, *this, rhs, 0.0, out);
+}
+
+Vector Matrix::operator*(const Vector& x) const {
+    Vector y(mRows);
+    multiply(x, y);
+    return y;
+}
+
+void Matrix::multiply(const Vector& x, Vector& y) const {
+    if (x.size() != mCols)
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (y.size() != mRows)
+        throw std::length_error("Output vector has wrong size");
+    if (&x == &y)
+        throw std::invalid_argument("Output vector must not alias the input");
+    const double* xp = x.data();
+    double*       yp = y.data();
+    parallelFor(0, mRows, rowGrain(mCols), [&](std::size_t r0, std::size_t r1) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            const double* a = row(i);
+            double dot = 0.0;
+            for (std::size_t j = 0; j < mCols; ++j)
+                dot += a[j] * xp[j];
+            yp[i] = dot;
+        }
+    });
+}
+
+// Row blocks accumulate private partial sums that are added in block order,
+// so the result does not depend on the thread count.
+void Matrix::transposeMultiply(const Vector& x, Vector& y) const {
+    std::vector<double> scratch;
+    transposeMultiply(x, y, scratch);
+}
+
+void Matrix::transposeMultiply(const Vector& x, Vector& y, std::vector<double>& scratch) const {
+    if (x.size() != mRows)
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (y.size() != mCols)
+        throw std::length_error("Output vector has wrong size");
+    if (&x == &y)
+        throw std::invalid_argument("Output vector must not alias the input");
+    const double* xp = x.data();
+    double*       yp = y.data();
+    const std::size_t grain  = rowGrain(mCols);
+    const std::size_t blocks = chunkCount(mRows, grain);
+
+    auto accumulate = [&](std::size_t r0, std::size_t r1, double* out) {
+        std::fill(out, out + mCols, 0.0);
+        for (std::size_t i = r0; i < r1; ++i) {
+            const double* a  = row(i);
+            const double  xi = xp[i];
+            for (std::size_t j = 0; j < mCols; ++j)
+                out[j] += a[j] * xi;
+        }
+    };
+    if (blocks <= 1) {
+        accumulate(0, mRows, yp);
+        return;
+    }
+    if (scratch.size() < blocks * mCols)
+        scratch.resize(blocks * mCols);
+    double* partial = scratch.data();
+    parallelFor(0, mRows, grain, [&](std::size_t r0, std::size_t r1) {
+        accumulate(r0, r1, partial + (r0 / grain) * mCols);
+    });
+    std::copy(partial, partial + mCols, yp);
+    for (std::size_t b = 1; b < blocks; ++b) {
+        const double* p = partial + b * mCols;
+        for (std::size_t j = 0; j < mCols; ++j)
+            yp[j] += p[j];
+    }
 }
 
-const double& Matrix::operator()(std::size_t i, std::size_t j) const {
-    if (i == 0 || i > mRows || j == 0 || j > mCols)
-        throw std::out_of_range("Matrix 1-based index out of range");
-    return mData[i - 1][j - 1];
+void Matrix::forRowBlocks(const std::function<void(std::size_t, std::size_t)>& fn) const {
+    parallelFor(0, mRows, rowGrain(mCols), fn);
 }
 
-Matrix Matrix::operator+(const Matrix& rhs) const {
+Matrix& Matrix::operator+=(const Matrix& rhs) {
     if (rhs.mRows != mRows || rhs.mCols != mCols)
         throw std::length_error("Matrix size mismatch");
-    Matrix out(mRows, mCols);
-    for (std::size_t i = 1; i <= mRows; ++i)
-        for (std::size_t j = 1; j <= mCols; ++j)
-            out(i,j) = (*this)(i,j) + rhs(i,j);
-    return out;
+    parallelFor(0, mRows, rowGrain(mCols), [&](std::size_t r0, std::size_t r1) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            const double* b = rhs.row(i);
+            double*       c = row(i);
+            for (std::size_t j = 0; j < mCols; ++j)
+                c[j] += b[j];
+        }
+    });
+    return *this;
 }
 
-Matrix Matrix::operator*(const Matrix& rhs) const {
-    if (mCols != rhs.mRows)
-        throw std::length_error("Matrix inner dimensions must agree");
-    Matrix out(mRows, rhs.mCols);
-    for (std::size_t i = 1; i <= mRows; ++i)
-        for (std::size_t j = 1; j <= rhs.mCols; ++j)
-            for (std::size_t k = 1; k <= mCols; ++k)
-                out(i,j) += (*this)(i,k) * rhs(k,j);
-    return out;
+Matrix& Matrix::operator-=(const Matrix& rhs) {
+    if (rhs.mRows != mRows || rhs.mCols != mCols)
+        throw std::length_error("Matrix size mismatch");
+    parallelFor(0, mRows, rowGrain(mCols), [&](std::size_t r0, std::size_t r1) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            const double* b = rhs.row(i);
+            double*       c = row(i);
+            for (std::size_t j = 0; j < mCols; ++j)
+                c[j] -= b[j];
+        }
+    });
+    return *this;
 }
 
-Matrix Matrix::operator*(double scalar) const {
-    Matrix out(mRows, mCols);
-    for (std::size_t i = 1; i <= mRows; ++i)
-        for (std::size_t j = 1; j <= mCols; ++j)
-            out(i,j) = (*this)(i,j) * scalar;
-    return out;
+Matrix& Matrix::operator*=(double scalar) {
+    parallelFor(0, mRows, rowGrain(mCols), [&](std::size_t r0, std::size_t r1) {
+        for (std::size_t i = r0; i < r1; ++i) {
+            double* c = row(i);
+            for (std::size_t j = 0; j < mCols; ++j)
+                c[j] *= scalar;
+        }
+    });
+    return *this;
+}
+
+double Matrix::determinant() const {
+    if (mRows != mCols)
+        throw std::invalid_argument("Determinant requires a square matrix");
+    if (mRows == 0)
+        return 1.0;
+    try {
+        return LUFactorization(*this).determinant();
+    } catch (const std::runtime_error&) {
+        return 0.0;   // a pivot vanished relative to its column: singular
+    }
+}
+
+Matrix Matrix::inverse() const {
+    if (mRows != mCols)
+        throw std::invalid_argument("Inverse requires a square matrix");
+    return LUFactorization(*this).inverse();
+}
+
+Matrix Matrix::pseudoInverse() const {
+    return SVDFactorization(*this).pseudoInverse();
 }
 
-std::size_t Matrix::rows() const noexcept { return mRows; }
-std::size_t Matrix::cols() const noexcept { return mCols; }
+Matrix Matrix::pseudoInverse(double tol) const {
+    return SVDFactorization(*this).pseudoInverse(tol);
+}
 
-// TODO: implement determinant(), inverse(), pseudoInverse()
+Matrix MatrixView::toMatrix() const {
+    Matrix out(mRows, mCols);
+    for (std::size_t i = 0; i < mRows; ++i)
+        std::copy(row(i), row(i) + mCols, out.row(i));
+    return out;
+}
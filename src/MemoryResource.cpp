@@ -0,0 +1,188 @@
+// src/MemoryResource.cpp
+#include "MemoryResource.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace {
+
+class NewDeleteResource : public MemoryResource {
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override {
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+    void doDeallocate(void* p, std::size_t, std::size_t alignment) noexcept override {
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+};
+
+thread_local MemoryResource* tlsResource = nullptr;
+
+// Size class c holds buffers of kMinPooledBytes << c bytes.
+std::size_t sizeClass(std::size_t bytes) noexcept {
+    std::size_t c = 0;
+    while ((PoolResource::kMinPooledBytes << c) < bytes)
+        ++c;
+    return c;
+}
+
+} // namespace
+
+MemoryResource::~MemoryResource() = default;
+
+MemoryResource* newDeleteResource() noexcept {
+    static NewDeleteResource resource;
+    return &resource;
+}
+
+MemoryResource* currentResource() noexcept {
+    return tlsResource ? tlsResource : newDeleteResource();
+}
+
+MemoryResource* setCurrentResource(MemoryResource* resource) noexcept {
+    MemoryResource* previous = currentResource();
+    tlsResource = resource;
+    return previous;
+}
+
+// --- ArenaResource ----------------------------------------------------------
+
+ArenaResource::ArenaResource(std::size_t blockBytes, MemoryResource* upstream)
+    : mUpstream(upstream ? upstream : newDeleteResource()),
+      mBlockBytes(std::max<std::size_t>(blockBytes, kDefaultAlignment))
+{
+}
+
+ArenaResource::~ArenaResource() {
+    release();
+}
+
+void* ArenaResource::doAllocate(std::size_t bytes, std::size_t alignment) {
+    // Carve from the current block, then from later blocks kept by reset().
+    for (; mCurrent < mBlocks.size(); ++mCurrent, mOffset = 0) {
+        const Block& b = mBlocks[mCurrent];
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(b.data);
+        const std::size_t start =
+            ((base + mOffset + alignment - 1) & ~std::uintptr_t(alignment - 1)) - base;
+        if (start <= b.size && bytes <= b.size - start) {
+            mUsed  += start + bytes - mOffset;
+            mOffset = start + bytes;
+            return b.data + start;
+        }
+    }
+    // Blocks are allocated at kDefaultAlignment, so larger alignments need slack.
+    const std::size_t slack = alignment > kDefaultAlignment ? alignment : 0;
+    const std::size_t size  = std::max(mBlockBytes, bytes + slack);
+    mBlocks.reserve(mBlocks.size() + 1);
+    mBlocks.push_back({static_cast<unsigned char*>(mUpstream->allocate(size)), size});
+    mCurrent = mBlocks.size() - 1;
+    mOffset  = 0;
+    return doAllocate(bytes, alignment);
+}
+
+void ArenaResource::doDeallocate(void*, std::size_t, std::size_t) noexcept {
+}
+
+void ArenaResource::reset() noexcept {
+    mCurrent = 0;
+    mOffset  = 0;
+    mUsed    = 0;
+}
+
+void ArenaResource::release() noexcept {
+    for (const Block& b : mBlocks)
+        mUpstream->deallocate(b.data, b.size);
+    mBlocks.clear();
+    reset();
+}
+
+std::size_t ArenaResource::bytesUsed() const noexcept { return mUsed; }
+
+std::size_t ArenaResource::capacity() const noexcept {
+    std::size_t total = 0;
+    for (const Block& b : mBlocks)
+        total += b.size;
+    return total;
+}
+
+// --- PoolResource -----------------------------------------------------------
+
+PoolResource::PoolResource(MemoryResource* upstream)
+    : mUpstream(upstream ? upstream : newDeleteResource()),
+      mFree(sizeClass(kMaxPooledBytes) + 1), mLive(mFree.size(), 0)
+{
+}
+
+PoolResource::~PoolResource() {
+    release();
+}
+
+void* PoolResource::doAllocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes > kMaxPooledBytes || alignment > kDefaultAlignment)
+        return mUpstream->allocate(bytes, alignment);
+    const std::size_t c = sizeClass(bytes);
+    std::vector<void*>& list = mFree[c];
+    if (!list.empty()) {
+        void* p = list.back();
+        list.pop_back();
+        return p;
+    }
+    // Keep room in the free list for every live buffer of the class, so
+    // the matching deallocate never has to grow it (and cannot throw).
+    list.reserve(mLive[c] + 1);
+    void* p = mUpstream->allocate(kMinPooledBytes << c);
+    ++mLive[c];
+    return p;
+}
+
+void PoolResource::doDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept {
+    if (bytes > kMaxPooledBytes || alignment > kDefaultAlignment) {
+        mUpstream->deallocate(p, bytes, alignment);
+        return;
+    }
+    mFree[sizeClass(bytes)].push_back(p);
+}
+
+void PoolResource::release() noexcept {
+    for (std::size_t c = 0; c < mFree.size(); ++c) {
+        for (void* p : mFree[c])
+            mUpstream->deallocate(p, kMinPooledBytes << c);
+        mLive[c] -= mFree[c].size();
+        mFree[c].clear();
+    }
+}
+
+std::size_t PoolResource::cachedBuffers() const noexcept {
+    std::size_t total = 0;
+    for (const auto& list : mFree)
+        total += list.size();
+    return total;
+}
+
+// --- Scopes -----------------------------------------------------------------
+
+ScopedResource::ScopedResource(MemoryResource& resource) noexcept
+    : mPrevious(setCurrentResource(&resource))
+{
+}
+
+ScopedResource::~ScopedResource() {
+    setCurrentResource(mPrevious);
+}
+
+ScopedArena::ScopedArena(std::size_t blockBytes)
+    : mOwned(std::make_unique<ArenaResource>(blockBytes)),
+      mArena(mOwned.get()),
+      mPrevious(setCurrentResource(mArena))
+{
+}
+
+ScopedArena::ScopedArena(ArenaResource& arena) noexcept
+    : mArena(&arena), mPrevious(setCurrentResource(mArena))
+{
+}
+
+ScopedArena::~ScopedArena() {
+    setCurrentResource(mPrevious);
+    mArena->reset();
+}
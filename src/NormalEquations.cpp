@@ -0,0 +1,95 @@
+// src/NormalEquations.cpp
+#include "NormalEquations.hpp"
+#include "Blas.hpp"
+#include "Factorization.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+NormalEquationAccumulator::NormalEquationAccumulator(std::size_t features)
+    : mFeatures(features), mCount(0), mGram(features, features), mRhs(features),
+      mSumSquares(0.0)
+{
+}
+
+std::size_t NormalEquationAccumulator::features() const noexcept { return mFeatures; }
+std::size_t NormalEquationAccumulator::count() const noexcept { return mCount; }
+
+void NormalEquationAccumulator::add(const Matrix& X, const Vector& y) {
+    if (X.cols() != mFeatures)
+        throw std::length_error("Chunk has the wrong number of features");
+    if (y.size() != X.rows())
+        throw std::length_error("Matrix/vector dimensions must agree");
+    add(X.rows(), X.data(), X.stride(), y.data());
+}
+
+void NormalEquationAccumulator::add(std::size_t m, const double* X, std::size_t ldx,
+                                    const double* y)
+{
+    if (m == 0)
+        return;
+    ::gram(m, mFeatures, X, ldx, y, 1.0, mGram.data(), mGram.stride(), mRhs.data());
+    double ss = 0.0;
+    for (std::size_t i = 0; i < m; ++i)
+        ss += y[i] * y[i];
+    mSumSquares += ss;
+    mCount += m;
+}
+
+void NormalEquationAccumulator::addRow(const double* x, double y) {
+    for (std::size_t i = 0; i < mFeatures; ++i) {
+        double* gi = mGram.row(i);
+        for (std::size_t j = 0; j < mFeatures; ++j)
+            gi[j] += x[i] * x[j];
+        mRhs[i] += x[i] * y;
+    }
+    mSumSquares += y * y;
+    ++mCount;
+}
+
+void NormalEquationAccumulator::merge(const NormalEquationAccumulator& other) {
+    if (other.mFeatures != mFeatures)
+        throw std::length_error("Accumulators have different feature counts");
+    mGram += other.mGram;
+    mRhs += other.mRhs;
+    mSumSquares += other.mSumSquares;
+    mCount += other.mCount;
+}
+
+void NormalEquationAccumulator::subtract(const NormalEquationAccumulator& other) {
+    if (other.mFeatures != mFeatures)
+        throw std::length_error("Accumulators have different feature counts");
+    if (other.mCount > mCount)
+        throw std::invalid_argument("Cannot subtract more rows than were accumulated");
+    mGram -= other.mGram;
+    mRhs -= other.mRhs;
+    mSumSquares -= other.mSumSquares;
+    mCount -= other.mCount;
+}
+
+void NormalEquationAccumulator::reset() {
+    std::fill(mGram.begin(), mGram.end(), 0.0);
+    std::fill(mRhs.begin(), mRhs.end(), 0.0);
+    mSumSquares = 0.0;
+    mCount = 0;
+}
+
+const Matrix& NormalEquationAccumulator::gram() const noexcept { return mGram; }
+const Vector& NormalEquationAccumulator::rhs() const noexcept { return mRhs; }
+double NormalEquationAccumulator::sumSquares() const noexcept { return mSumSquares; }
+
+Vector NormalEquationAccumulator::solve(double ridge) const {
+    if (ridge == 0.0)
+        return CholeskyFactorization(mGram).solve(mRhs);
+    Matrix A(mGram);
+    for (std::size_t i = 0; i < mFeatures; ++i)
+        A.row(i)[i] += ridge;
+    return CholeskyFactorization(A).solve(mRhs);
+}
+
+double NormalEquationAccumulator::residualSumOfSquares(const Vector& beta) const {
+    if (beta.size() != mFeatures)
+        throw std::length_error("Coefficient vector has wrong size");
+    Vector Gb = mGram * beta;
+    // Cancellation can leave a tiny negative value for a perfect fit.
+    return std::max(0.0, mSumSquares - 2.0 * beta.dot(mRhs) + beta.dot(Gb));
+}
@@ -0,0 +1,141 @@
+// src/OnlineRegression.cpp
+#include "OnlineRegression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+OnlineRegression::OnlineRegression(std::size_t features, double ridge, double forgetting)
+    : mFeatures(features), mCount(0), mForgetting(forgetting),
+      mR(features, features), mXty(features), mWork(features), mBeta(features),
+      mDirty(true)
+{
+    if (ridge < 0.0)
+        throw std::invalid_argument("Ridge parameter must be non-negative");
+    if (!(forgetting > 0.0 && forgetting <= 1.0))
+        throw std::invalid_argument("Forgetting factor must lie in (0, 1]");
+    const double r = std::sqrt(ridge);
+    for (std::size_t i = 0; i < features; ++i)
+        mR.row(i)[i] = r;
+}
+
+std::size_t OnlineRegression::features() const noexcept { return mFeatures; }
+std::size_t OnlineRegression::count() const noexcept { return mCount; }
+double OnlineRegression::forgetting() const noexcept { return mForgetting; }
+
+// Rotate the row x into R: RᵀR + xxᵀ = R'ᵀR'.
+void OnlineRegression::add(const double* x, double y) {
+    const std::size_t p = mFeatures;
+    if (mForgetting != 1.0) {
+        const double s = std::sqrt(mForgetting);
+        for (double& v : mR) v *= s;
+        mXty *= mForgetting;
+    }
+    double* w = mWork.data();
+    std::copy(x, x + p, w);
+    for (std::size_t k = 0; k < p; ++k) {
+        if (w[k] == 0.0)
+            continue;
+        double* rk = mR.row(k);
+        const double r = std::hypot(rk[k], w[k]);
+        const double c = rk[k] / r;
+        const double s = w[k] / r;
+        rk[k] = r;
+        for (std::size_t j = k + 1; j < p; ++j) {
+            const double a = rk[j];
+            rk[j] = c * a + s * w[j];
+            w[j]  = c * w[j] - s * a;
+        }
+    }
+    double* b = mXty.data();
+    for (std::size_t i = 0; i < p; ++i)
+        b[i] += x[i] * y;
+    ++mCount;
+    mDirty = true;
+}
+
+void OnlineRegression::add(const Vector& x, double y) {
+    if (x.size() != mFeatures)
+        throw std::length_error("Observation has the wrong number of features");
+    add(x.data(), y);
+}
+
+void OnlineRegression::add(const Matrix& X, const Vector& y) {
+    if (X.cols() != mFeatures)
+        throw std::length_error("Observation has the wrong number of features");
+    if (y.size() != X.rows())
+        throw std::length_error("Matrix/vector dimensions must agree");
+    for (std::size_t i = 0; i < X.rows(); ++i)
+        add(X.row(i), y[i]);
+}
+
+// Hyperbolic rotations: RᵀR - xxᵀ = R'ᵀR'. Work on a copy so a failed
+// downdate leaves the model untouched.
+void OnlineRegression::remove(const double* x, double y) {
+    const std::size_t p = mFeatures;
+    if (mCount == 0)
+        throw std::runtime_error("No observations to remove");
+    Matrix R(mR);
+    double* w = mWork.data();
+    std::copy(x, x + p, w);
+    for (std::size_t k = 0; k < p; ++k) {
+        if (w[k] == 0.0)
+            continue;
+        double* rk = R.row(k);
+        const double d = (rk[k] - w[k]) * (rk[k] + w[k]);
+        if (!(d > 0.0))
+            throw std::runtime_error("Downdate would make the system indefinite");
+        const double r = std::sqrt(d);
+        const double c = r / rk[k];
+        const double s = w[k] / rk[k];
+        rk[k] = r;
+        for (std::size_t j = k + 1; j < p; ++j) {
+            rk[j] = (rk[j] - s * w[j]) / c;
+            w[j]  = c * w[j] - s * rk[j];
+        }
+    }
+    mR = std::move(R);
+    double* b = mXty.data();
+    for (std::size_t i = 0; i < p; ++i)
+        b[i] -= x[i] * y;
+    --mCount;
+    mDirty = true;
+}
+
+void OnlineRegression::remove(const Vector& x, double y) {
+    if (x.size() != mFeatures)
+        throw std::length_error("Observation has the wrong number of features");
+    remove(x.data(), y);
+}
+
+// Solve RᵀR β = Xᵀy: forward with Rᵀ (column sweeps), then back with R.
+const Vector& OnlineRegression::coefficients() const {
+    if (!mDirty)
+        return mBeta;
+    const std::size_t p = mFeatures;
+    double rmax = 0.0;
+    for (std::size_t k = 0; k < p; ++k)
+        rmax = std::max(rmax, std::abs(mR.row(k)[k]));
+    for (std::size_t k = 0; k < p; ++k)
+        if (!(std::abs(mR.row(k)[k]) > 1e-12 * rmax))
+            throw std::runtime_error("Not enough observations to determine the coefficients");
+
+    double* z = mBeta.data();
+    std::copy(mXty.begin(), mXty.end(), z);
+    for (std::size_t k = 0; k < p; ++k) {
+        const double* rk = mR.row(k);
+        z[k] /= rk[k];
+        for (std::size_t i = k + 1; i < p; ++i)
+            z[i] -= rk[i] * z[k];
+    }
+    for (std::size_t i = p; i-- > 0;) {
+        const double* ri = mR.row(i);
+        double sum = z[i];
+        for (std::size_t j = i + 1; j < p; ++j)
+            sum -= ri[j] * z[j];
+        z[i] = sum / ri[i];
+    }
+    mDirty = false;
+    return mBeta;
+}
+
+const Matrix& OnlineRegression::factor() const noexcept { return mR; }
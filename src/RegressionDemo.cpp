@@ -1,85 +1,135 @@
 // src/RegressionDemo.cpp
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <vector>
-#include <array>        // for std::array<double,6>
 #include <random>
 #include <algorithm>    // for std::shuffle
 #include <iomanip>
 #include <cmath>
+#include <stdexcept>
 #include "Matrix.hpp"
 #include "Vector.hpp"
+#include "BinaryDataset.hpp"
+#include "Blas.hpp"
+#include "CrossValidation.hpp"
+#include "Dataset.hpp"
+#include "FixedMatrix.hpp"
+#include "LinearModel.hpp"
 #include "LinearSystem.hpp"
+#include "NormalEquations.hpp"
 
 static void print_usage() {
-    std::cout << "Usage: RegressionDemo --data <path> --train-split <0-1> --seed <int>\n";
+    std::cout << "Usage: RegressionDemo --data <path> --train-split <0-1> --seed <int>"
+                 " [--solver cholesky|qr|cg] [--stream [--chunk-rows <n>]]\n"
+                 "       RegressionDemo --data <path> --cv <folds> [--repeats <n>] [--seed <int>]\n"
+                 "       RegressionDemo --data <csv> --convert <binary>\n"
+                 "--data accepts machine.data CSV or a binary dataset written by --convert.\n";
 }
 
-int main(int argc, char* argv[]) {
-    std::string data_file;
-    double train_split = 0.8;
-    unsigned seed = 42;
+// machine.data: vendor, model, 6 numeric features, PRP (target), ERP
+// (the original study's estimate, unused); an intercept column is appended.
+static CsvSchema machine_schema() {
+    CsvSchema schema;
+    schema.columns = { ColumnRole::Ignore, ColumnRole::Ignore,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                       ColumnRole::Target, ColumnRole::Ignore };
+    schema.intercept = true;
+    return schema;
+}
 
-    // Parse arguments
-    for (int i = 1; i < argc; ++i) {
-        std::string arg = argv[i];
-        if (arg == "--data" && i+1 < argc) {
-            data_file = argv[++i];
-        }
-        else if (arg == "--train-split" && i+1 < argc) {
-            train_split = std::stod(argv[++i]);
-        }
-        else if (arg == "--seed" && i+1 < argc) {
-            seed = static_cast<unsigned>(std::stoi(argv[++i]));
-        }
-        else {
-            print_usage();
-            return 1;
-        }
-    }
-    if (data_file.empty() || train_split <= 0.0 || train_split >= 1.0) {
-        print_usage();
-        return 1;
+// Normal equations via CG; feature scales differ by orders of magnitude,
+// so a Jacobi preconditioner evens them out.
+static Vector solve_cg(const Matrix& A, const Vector& b) {
+    JacobiPreconditioner jacobi(A);
+    Vector x(b.size());
+    CGResult res = PosSymLinSystem(A, b, CGOptions(), &jacobi).Solve(x);
+    if (!res.converged)
+        std::cerr << "Warning: CG stopped after " << res.iterations
+                  << " iterations (residual " << res.residualNorm << ")\n";
+    return x;
+}
+
+static void print_results(const Vector& coeff, double rmse_train, double rmse_test) {
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Coefficients (x1..x7):\n";
+    for (size_t i = 1; i <= 7; ++i)
+        std::cout << "  x" << i << " = " << coeff[i-1] << "\n";
+    std::cout << "\nTrain RMSE: " << rmse_train << "\n";
+    std::cout << "Test  RMSE: " << rmse_test  << "\n";
+}
+
+// Out-of-core fit: one pass over the file, each row sent to train or test
+// by a seeded coin flip, buffered into chunk_rows-row chunks and folded
+// into that split's normal equations. Memory is O(chunk + p²) whatever the
+// file size; RMSEs come from the accumulated yᵀy, so no second pass.
+static int run_streaming(const std::string& data_file, double train_split, unsigned seed,
+                         const std::string& solver_name, size_t chunk_rows) {
+    NormalEquationAccumulator train(7), test(7);
+    Matrix chunkX[2] = { Matrix(chunk_rows, 7), Matrix(chunk_rows, 7) };
+    Vector chunkY[2] = { Vector(chunk_rows), Vector(chunk_rows) };
+    NormalEquationAccumulator* acc[2] = { &train, &test };
+    size_t fill[2] = { 0, 0 };
+    auto flush = [&](int s) {
+        acc[s]->add(fill[s], chunkX[s].data(), chunkX[s].stride(), chunkY[s].data());
+        fill[s] = 0;
+    };
+
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution to_train(train_split);
+    auto route = [&](const double* x, double y) {
+        const int s = to_train(rng) ? 0 : 1;
+        std::copy(x, x + 7, chunkX[s].row(fill[s]));
+        chunkY[s][fill[s]] = y;
+        if (++fill[s] == chunk_rows) flush(s);
+    };
+    if (isBinaryDataset(data_file)) {
+        // Rows come straight from the mapping; pages are touched once.
+        BinaryDataset bin(data_file);
+        if (bin.cols() != 7)
+            throw std::runtime_error("Binary dataset must have 7 feature columns");
+        MatrixView X = bin.features();
+        Span<const double> y = bin.target();
+        for (size_t i = 0; i < X.rows(); ++i)
+            route(X.row(i), y[i]);
+    } else {
+        CsvReader reader(data_file, machine_schema());
+        Matrix rows(chunk_rows, 7);
+        Vector targets(chunk_rows);
+        while (size_t n = reader.readChunk(rows, targets))
+            for (size_t i = 0; i < n; ++i)
+                route(rows.row(i), targets[i]);
     }
+    flush(0);
+    flush(1);
 
-    // Read CSV
-    std::ifstream infile(data_file);
-    if (!infile.is_open()) {
-        std::cerr << "Error: cannot open data file: " << data_file << "\n";
+    std::cout << "RegressionDemo v1.0\n";
+    std::cout << "Streamed " << train.count() + test.count() << " samples ("
+              << train.count() << " train / " << test.count() << " test)\n\n";
+    if (train.count() < 7 || test.count() == 0) {
+        std::cerr << "Error: not enough rows in one of the splits\n";
         return 1;
     }
-    std::string line;
-    std::vector<std::array<double,6>> features;
-    std::vector<double> targets;
-    while (std::getline(infile, line)) {
-        if (line.empty()) continue;
-        std::stringstream ss(line);
-        std::string field;
-        // Skip vendor and model names
-        std::getline(ss, field, ',');
-        std::getline(ss, field, ',');
-
-        // Read 6 numeric features
-        std::array<double,6> x;
-        for (int j = 0; j < 6; ++j) {
-            std::getline(ss, field, ',');
-            x[j] = std::stod(field);
-        }
-
-        // Read PRP value and ignore final ERP column
-        std::getline(ss, field, ',');␊
-        double prp = std::stod(field);
-        std::getline(ss, field, ','); // ERP (unused)
 
-        features.push_back(x);
-        targets.push_back(prp);
-    }
-    infile.close();
+    Vector coeff = solver_name == "cg" ? solve_cg(train.gram(), train.rhs())
+                                       : train.solve();
+    print_results(coeff,
+                  std::sqrt(train.residualSumOfSquares(coeff) / double(train.count())),
+                  std::sqrt(test.residualSumOfSquares(coeff) / double(test.count())));
+    return 0;
+}
 
-    size_t N = targets.size();
+// Shuffle the rows of (X, y) into train/test and fit in memory.
+static int fit_in_memory(MatrixView X, Span<const double> y, double train_split,
+                         unsigned seed, const std::string& solver_name) {
+    if (X.cols() != 7)
+        throw std::runtime_error("Dataset must have 7 feature columns");
+    size_t N = y.size();
     size_t trainN = static_cast<size_t>(train_split * N);
     size_t testN  = N - trainN;
+    if (testN == 0) {
+        std::cerr << "Error: not enough rows in one of the splits\n";
+        return 1;
+    }
 
     // Shuffle indices
     std::vector<size_t> idx(N);
@@ -87,71 +137,176 @@ int main(int argc, char* argv[]) {
     std::mt19937 rng(seed);
     std::shuffle(idx.begin(), idx.end(), rng);
 
-    // Build design matrices (features + intercept)
+    // Build design matrices (rows already carry the intercept column)
     Matrix Xtrain(trainN, 7), Xtest(testN, 7);
     Vector ytrain(trainN), ytest(testN);
 
     for (size_t i = 0; i < trainN; ++i) {
-        auto& row = features[idx[i]];
-        for (size_t j = 0; j < 6; ++j)
-            Xtrain(i+1, j+1) = row[j];
-        Xtrain(i+1, 7) = 1.0;  // intercept
-        ytrain[i] = targets[idx[i]];
+        const double* row = X.row(idx[i]);
+        std::copy(row, row + 7, Xtrain.row(i));
+        ytrain[i] = y[idx[i]];
     }
     for (size_t i = 0; i < testN; ++i) {
-        auto& row = features[idx[trainN + i]];
-        for (size_t j = 0; j < 6; ++j)
-            Xtest(i+1, j+1) = row[j];
-        Xtest(i+1, 7) = 1.0;
-        ytest[i] = targets[idx[trainN + i]];
+        const double* row = X.row(idx[trainN + i]);
+        std::copy(row, row + 7, Xtest.row(i));
+        ytest[i] = y[idx[trainN + i]];
     }
 
     std::cout << "RegressionDemo v1.0\n";
     std::cout << "Loaded " << N << " samples (" << trainN << " train / " << testN << " test)\n\n";
 
-    // Normal equations: A = X^T X, b = X^T y
-    Matrix A(7,7);
-    Vector b(7);
-    for (size_t i = 1; i <= 7; ++i) {
-        for (size_t j = 1; j <= 7; ++j) {
-            double sum = 0.0;
-            for (size_t k = 1; k <= trainN; ++k)
-                sum += Xtrain(k,i) * Xtrain(k,j);
-            A(i,j) = sum;
-        }
-        double sum2 = 0.0;
-        for (size_t k = 1; k <= trainN; ++k)
-            sum2 += Xtrain(k,i) * ytrain[k-1];
-        b[i-1] = sum2;
+    // Solve: QR works on the design matrix directly; the other solvers
+    // use the normal equations.
+    Vector coeff(7);
+    if (solver_name == "qr") {
+        coeff = LeastSquaresSystem(Xtrain, ytrain).Solve();
+    } else {
+        // Normal equations: A = X^T X, b = X^T y in one fused pass over X,
+        // written straight into stack storage.
+        FixedMatrix<7, 7> A;
+        FixedVector<7> b;
+        gram(trainN, 7, Xtrain.data(), Xtrain.stride(), ytrain.data(),
+             0.0, A.data(), A.cols(), b.data());
+
+        if (solver_name == "cg")
+            coeff = solve_cg(A.toMatrix(), b.toVector());
+        else
+            coeff = FixedCholeskyFactorization<7>(A).solve(b).toVector();
     }
 
-    // Solve
-    PosSymLinSystem solver(A, b);
-    Vector coeff = solver.Solve();
-
-    // RMSE calculation
-    auto compute_rmse = [&](const Matrix& X, const Vector& y, size_t M) {
-        double rss = 0.0;
-        for (size_t i = 1; i <= M; ++i) {
-            double pred = 0.0;
-            for (size_t j = 1; j <= 7; ++j)
-                pred += X(i,j) * coeff[j-1];
-            double err = pred - y[i-1];
-            rss += err * err;
-        }
-        return std::sqrt(rss / M);
-    };
+    // Score both splits with the fitted model (one fused pass each)
+    const LinearModel model(coeff);
+    double rmse_train = model.evaluate(Xtrain, ytrain).rmse;
+    double rmse_test  = model.evaluate(Xtest,  ytest).rmse;
 
-    double rmse_train = compute_rmse(Xtrain, ytrain, trainN);
-    double rmse_test  = compute_rmse(Xtest,  ytest,  testN);
+    print_results(coeff, rmse_train, rmse_test);
 
-    // Output results
-    std::cout << std::fixed << std::setprecision(6);
-    std::cout << "Coefficients (x1..x7):\n";
-    for (size_t i = 1; i <= 7; ++i)
-        std::cout << "  x" << i << " = " << coeff[i-1] << "\n";
-    std::cout << "\nTrain RMSE: " << rmse_train << "\n";
-    std::cout << "Test  RMSE: " << rmse_test  << "\n";
+    return 0;
+}
+
+// Binary datasets are fitted straight from the mapping, CSV is parsed first.
+static int run_in_memory(const std::string& data_file, double train_split, unsigned seed,
+                         const std::string& solver_name) {
+    if (isBinaryDataset(data_file)) {
+        BinaryDataset bin(data_file);
+        return fit_in_memory(bin.features(), bin.target(), train_split, seed, solver_name);
+    }
+    Dataset data = readCsv(data_file, machine_schema());
+    return fit_in_memory(data.X, Span<const double>(data.y.data(), data.y.size()),
+                         train_split, seed, solver_name);
+}
+
+// Repeated k-fold CV: one shuffled partition per seed (seed, seed+1, ...).
+static int cross_validate(MatrixView X, Span<const double> y, size_t folds,
+                          size_t repeats, unsigned seed) {
+    if (X.cols() != 7)
+        throw std::runtime_error("Dataset must have 7 feature columns");
+    CrossValidationOptions options;
+    options.folds = folds;
+    options.seeds.clear();
+    for (size_t r = 0; r < repeats; ++r)
+        options.seeds.push_back(seed + static_cast<unsigned>(r));
+    CrossValidationResult cv = crossValidate(X, y, options);
 
+    std::cout << "RegressionDemo v1.0\n";
+    std::cout << "Loaded " << y.size() << " samples (" << folds << "-fold CV x "
+              << repeats << " repeats, " << cv.folds.size() << " fits)\n\n";
+    std::cout << std::fixed << std::setprecision(6);
+    auto report = [](const char* name, const MetricSummary& m) {
+        std::cout << name << m.mean << " (sd " << std::sqrt(m.variance) << ")\n";
+    };
+    report("Train RMSE: ", cv.trainRmse);
+    report("Test  RMSE: ", cv.testRmse);
+    report("Test  MAE:  ", cv.testMae);
     return 0;
 }
+
+static int run_cross_validation(const std::string& data_file, size_t folds,
+                                size_t repeats, unsigned seed) {
+    if (isBinaryDataset(data_file)) {
+        BinaryDataset bin(data_file);
+        return cross_validate(bin.features(), bin.target(), folds, repeats, seed);
+    }
+    Dataset data = readCsv(data_file, machine_schema());
+    return cross_validate(data.X, Span<const double>(data.y.data(), data.y.size()),
+                          folds, repeats, seed);
+}
+
+int main(int argc, char* argv[]) {
+    std::string data_file;
+    double train_split = 0.8;
+    unsigned seed = 42;
+    std::string solver_name = "cholesky";
+    bool stream = false;
+    size_t chunk_rows = 65536;
+    std::string convert_to;
+    size_t cv_folds = 0;
+    size_t cv_repeats = 1;
+
+    // Parse arguments
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--data" && i+1 < argc) {
+            data_file = argv[++i];
+        }
+        else if (arg == "--train-split" && i+1 < argc) {
+            train_split = std::stod(argv[++i]);
+        }
+        else if (arg == "--seed" && i+1 < argc) {
+            seed = static_cast<unsigned>(std::stoi(argv[++i]));
+        }
+        else if (arg == "--solver" && i+1 < argc) {
+            solver_name = argv[++i];
+        }
+        else if (arg == "--stream") {
+            stream = true;
+        }
+        else if (arg == "--convert" && i+1 < argc) {
+            convert_to = argv[++i];
+        }
+        else if (arg == "--cv" && i+1 < argc) {
+            cv_folds = static_cast<size_t>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--repeats" && i+1 < argc) {
+            cv_repeats = static_cast<size_t>(std::stoul(argv[++i]));
+        }
+        else if (arg == "--chunk-rows" && i+1 < argc) {
+            chunk_rows = static_cast<size_t>(std::stoul(argv[++i]));
+        }
+        else {
+            print_usage();
+            return 1;
+        }
+    }
+    if (data_file.empty() || train_split <= 0.0 || train_split >= 1.0 ||
+        (solver_name != "cholesky" && solver_name != "qr" && solver_name != "cg") ||
+        chunk_rows == 0 || cv_repeats == 0) {
+        print_usage();
+        return 1;
+    }
+    if (stream && solver_name == "qr") {
+        std::cerr << "Error: --stream accumulates normal equations; use --solver cholesky or cg\n";
+        return 1;
+    }
+    if (cv_folds != 0 && (stream || solver_name != "cholesky")) {
+        std::cerr << "Error: --cv fits the normal equations in memory; drop --stream and --solver\n";
+        return 1;
+    }
+
+    try {
+        if (!convert_to.empty()) {
+            convertCsvToBinary(data_file, machine_schema(), convert_to);
+            std::cout << "Wrote binary dataset " << convert_to << "\n";
+            return 0;
+        }
+        if (cv_folds != 0)
+            return run_cross_validation(data_file, cv_folds, cv_repeats, seed);
+        if (stream)
+            return run_streaming(data_file, train_split, seed, solver_name, chunk_rows);
+        return run_in_memory(data_file, train_split, seed, solver_name);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
+
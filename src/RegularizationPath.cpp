@@ -0,0 +1,215 @@
+// src/RegularizationPath.cpp
+#include "RegularizationPath.hpp"
+#include "Factorization.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Multiply-adds per parallelFor chunk when solving many λ at once.
+constexpr std::size_t kPathWork = std::size_t(1) << 16;
+
+double softThreshold(double x, double t) {
+    return x > t ? x - t : (x < -t ? x + t : 0.0);
+}
+
+} // namespace
+
+RidgePath::RidgePath(const Matrix& gram, const Vector& rhs)
+    : mV(0, 0), mEigen(0), mZ(0), mTolerance(0.0)
+{
+    if (gram.rows() != gram.cols())
+        throw std::invalid_argument("Gram matrix must be square");
+    if (rhs.size() != gram.rows())
+        throw std::length_error("Matrix/vector dimensions must agree");
+    // For a symmetric PSD matrix the SVD is the eigendecomposition, and the
+    // one-sided Jacobi V stays a full orthonormal basis even when rank deficient.
+    SVDFactorization svd(gram);
+    mV = svd.V();
+    mEigen = svd.singularValues();
+    mTolerance = svd.defaultTolerance();
+    mZ = Vector(rhs.size());
+    mV.transposeMultiply(rhs, mZ);
+}
+
+RidgePath::RidgePath(const NormalEquationAccumulator& normal)
+    : RidgePath(normal.gram(), normal.rhs())
+{
+}
+
+std::size_t RidgePath::features() const noexcept { return mZ.size(); }
+const Vector& RidgePath::eigenvalues() const noexcept { return mEigen; }
+
+void RidgePath::coefficients(double lambda, double* beta) const {
+    if (!(lambda >= 0.0))
+        throw std::invalid_argument("Ridge parameter must be non-negative");
+    const std::size_t p = features();
+    if (p == 0)
+        return;
+    if (mEigen[p - 1] + lambda <= mTolerance)
+        throw std::runtime_error("XᵀX + λI is singular; use a larger λ");
+    std::fill(beta, beta + p, 0.0);
+    for (std::size_t i = 0; i < p; ++i) {
+        const double* vi = mV.row(i);
+        double sum = 0.0;
+        for (std::size_t k = 0; k < p; ++k)
+            sum += vi[k] * (mZ[k] / (mEigen[k] + lambda));
+        beta[i] = sum;
+    }
+}
+
+Vector RidgePath::solve(double lambda) const {
+    Vector beta(features());
+    coefficients(lambda, beta.data());
+    return beta;
+}
+
+Matrix RidgePath::path(const std::vector<double>& lambdas) const {
+    const std::size_t p = features();
+    Matrix betas(lambdas.size(), p);
+    const std::size_t grain = std::max<std::size_t>(1, kPathWork / std::max<std::size_t>(1, p * p));
+    parallelFor(0, lambdas.size(), grain, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t l = begin; l < end; ++l)
+            coefficients(lambdas[l], betas.row(l));
+    });
+    return betas;
+}
+
+double RidgePath::degreesOfFreedom(double lambda) const {
+    if (!(lambda >= 0.0))
+        throw std::invalid_argument("Ridge parameter must be non-negative");
+    double df = 0.0;
+    for (std::size_t k = 0; k < mEigen.size(); ++k)
+        if (mEigen[k] + lambda > 0.0)
+            df += mEigen[k] / (mEigen[k] + lambda);
+    return df;
+}
+
+ElasticNetPath::ElasticNetPath(const NormalEquationAccumulator& normal,
+                               ElasticNetOptions options)
+    : mGram(normal.gram()), mRhs(normal.rhs()), mSumSquares(normal.sumSquares()),
+      mOptions(std::move(options))
+{
+    if (!(mOptions.alpha >= 0.0 && mOptions.alpha <= 1.0))
+        throw std::invalid_argument("Elastic-net alpha must lie in [0, 1]");
+    if (mOptions.penaltyFactors.empty())
+        mOptions.penaltyFactors.assign(normal.features(), 1.0);
+    if (mOptions.penaltyFactors.size() != normal.features())
+        throw std::length_error("One penalty factor per feature is required");
+    for (double w : mOptions.penaltyFactors)
+        if (!(w >= 0.0))
+            throw std::invalid_argument("Penalty factors must be non-negative");
+}
+
+std::size_t ElasticNetPath::features() const noexcept { return mRhs.size(); }
+const ElasticNetOptions& ElasticNetPath::options() const noexcept { return mOptions; }
+
+double ElasticNetPath::lambdaMax() const {
+    const std::size_t p = features();
+    const std::vector<double>& w = mOptions.penaltyFactors;
+    if (mOptions.alpha == 0.0)
+        return std::numeric_limits<double>::infinity();
+
+    // Least-squares fit of the unpenalized coefficients alone.
+    std::vector<std::size_t> free;
+    for (std::size_t j = 0; j < p; ++j)
+        if (w[j] == 0.0)
+            free.push_back(j);
+    Vector c(mRhs);
+    if (!free.empty()) {
+        Matrix Gff(free.size(), free.size());
+        Vector gf(free.size());
+        for (std::size_t a = 0; a < free.size(); ++a) {
+            for (std::size_t b = 0; b < free.size(); ++b)
+                Gff.row(a)[b] = mGram.row(free[a])[free[b]];
+            gf[a] = mRhs[free[a]];
+        }
+        const Vector bf = CholeskyFactorization(Gff).solve(gf);
+        for (std::size_t j = 0; j < p; ++j)
+            for (std::size_t a = 0; a < free.size(); ++a)
+                c[j] -= mGram.row(j)[free[a]] * bf[a];
+    }
+    double lmax = 0.0;
+    for (std::size_t j = 0; j < p; ++j)
+        if (w[j] > 0.0)
+            lmax = std::max(lmax, std::abs(c[j]) / (mOptions.alpha * w[j]));
+    return lmax;
+}
+
+std::vector<double> ElasticNetPath::lambdaGrid(std::size_t count, double ratio) const {
+    if (mOptions.alpha == 0.0)
+        throw std::invalid_argument("lambdaGrid needs alpha > 0");
+    if (!(ratio > 0.0 && ratio <= 1.0))
+        throw std::invalid_argument("Grid ratio must lie in (0, 1]");
+    const double lmax = lambdaMax();
+    std::vector<double> grid(count);
+    for (std::size_t l = 0; l < count; ++l)
+        grid[l] = count == 1 ? lmax : lmax * std::pow(ratio, double(l) / double(count - 1));
+    return grid;
+}
+
+ElasticNetFit ElasticNetPath::fit(double lambda, const Vector& start) const {
+    const std::size_t p = features();
+    if (start.size() != p)
+        throw std::length_error("Start vector has wrong size");
+    if (!(lambda >= 0.0))
+        throw std::invalid_argument("Penalty parameter must be non-negative");
+    const std::vector<double>& w = mOptions.penaltyFactors;
+    const double alpha = mOptions.alpha;
+
+    ElasticNetFit result;
+    result.lambda = lambda;
+    result.coefficients = start;
+    double* beta = result.coefficients.data();
+
+    // c = Xᵀy - XᵀXβ, kept current as coordinates move (rows of G are its columns).
+    Vector c(p);
+    mGram.multiply(result.coefficients, c);
+    for (std::size_t j = 0; j < p; ++j)
+        c[j] = mRhs[j] - c[j];
+
+    const double threshold = mOptions.tolerance * mSumSquares;
+    while (result.sweeps < mOptions.maxSweeps) {
+        ++result.sweeps;
+        double maxChange = 0.0;
+        for (std::size_t j = 0; j < p; ++j) {
+            const double* gj = mGram.row(j);
+            const double gjj = gj[j];
+            if (!(gjj > 0.0))
+                continue;   // all-zero column: β_j does not affect the fit
+            const double old = beta[j];
+            const double next = softThreshold(c[j] + gjj * old, lambda * alpha * w[j])
+                              / (gjj + lambda * (1.0 - alpha) * w[j]);
+            if (next == old)
+                continue;
+            const double d = next - old;
+            for (std::size_t k = 0; k < p; ++k)
+                c[k] -= d * gj[k];
+            beta[j] = next;
+            maxChange = std::max(maxChange, gjj * d * d);
+        }
+        if (maxChange <= threshold) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+ElasticNetFit ElasticNetPath::fit(double lambda) const {
+    return fit(lambda, Vector(features()));
+}
+
+std::vector<ElasticNetFit> ElasticNetPath::path(const std::vector<double>& lambdas) const {
+    std::vector<ElasticNetFit> fits;
+    fits.reserve(lambdas.size());
+    Vector start(features());
+    for (double lambda : lambdas) {
+        fits.push_back(fit(lambda, start));
+        start = fits.back().coefficients;
+    }
+    return fits;
+}
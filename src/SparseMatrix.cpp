@@ -0,0 +1,263 @@
+// src/SparseMatrix.cpp
+#include "SparseMatrix.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Parallel products hand each thread slices holding roughly this many nonzeros.
+constexpr std::size_t kNonZeroGrain = std::size_t(1) << 15;
+
+std::size_t sliceGrain(std::size_t slices, std::size_t nnz) {
+    if (nnz == 0)
+        return std::max<std::size_t>(slices, 1);
+    return std::max<std::size_t>(1, kNonZeroGrain * slices / nnz);
+}
+
+// y[k] = Σ values · x[inner] over each outer slice k.
+void gather(const std::vector<std::size_t>& outer, const std::vector<std::size_t>& inner,
+            const std::vector<double>& values, const double* x, double* y)
+{
+    const std::size_t slices = outer.size() - 1;
+    parallelFor(0, slices, sliceGrain(slices, values.size()),
+                [&](std::size_t k0, std::size_t k1) {
+        for (std::size_t k = k0; k < k1; ++k) {
+            double sum = 0.0;
+            for (std::size_t p = outer[k]; p < outer[k + 1]; ++p)
+                sum += values[p] * x[inner[p]];
+            y[k] = sum;
+        }
+    });
+}
+
+// y[inner] += values · x[k] over each outer slice k; y has @p n entries.
+// Blocks of slices scatter into private partials in @p scratch (summed in
+// block order) when those buffers are no bigger than the matrix itself.
+void scatter(const std::vector<std::size_t>& outer, const std::vector<std::size_t>& inner,
+             const std::vector<double>& values, const double* x, double* y, std::size_t n,
+             std::vector<double>& scratch)
+{
+    const std::size_t slices = outer.size() - 1;
+    auto accumulate = [&](std::size_t k0, std::size_t k1, double* out) {
+        std::fill(out, out + n, 0.0);
+        for (std::size_t k = k0; k < k1; ++k) {
+            const double xk = x[k];
+            for (std::size_t p = outer[k]; p < outer[k + 1]; ++p)
+                out[inner[p]] += values[p] * xk;
+        }
+    };
+    const std::size_t grain  = sliceGrain(slices, values.size());
+    const std::size_t blocks = chunkCount(slices, grain);
+    if (blocks <= 1 || blocks * n > values.size()) {
+        accumulate(0, slices, y);
+        return;
+    }
+    if (scratch.size() < blocks * n)
+        scratch.resize(blocks * n);
+    double* partial = scratch.data();
+    parallelFor(0, slices, grain, [&](std::size_t k0, std::size_t k1) {
+        accumulate(k0, k1, partial + (k0 / grain) * n);
+    });
+    std::copy(partial, partial + n, y);
+    for (std::size_t b = 1; b < blocks; ++b) {
+        const double* p = partial + b * n;
+        for (std::size_t i = 0; i < n; ++i)
+            y[i] += p[i];
+    }
+}
+
+} // namespace
+
+SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols, Format format)
+    : mRows(rows), mCols(cols), mFormat(format),
+      mOuter((format == Format::CSR ? rows : cols) + 1, 0)
+{
+}
+
+SparseMatrix::SparseMatrix(std::size_t rows, std::size_t cols,
+                           const std::vector<Triplet>& triplets, Format format)
+    : SparseMatrix(rows, cols, format)
+{
+    const bool csr = format == Format::CSR;
+    for (const Triplet& t : triplets) {
+        if (t.row >= rows || t.col >= cols)
+            throw std::out_of_range("Triplet index out of range");
+        ++mOuter[(csr ? t.row : t.col) + 1];
+    }
+    for (std::size_t k = 0; k < outerSize(); ++k)
+        mOuter[k + 1] += mOuter[k];
+
+    // Bucket by outer index, then sort each slice and sum duplicates.
+    std::vector<std::pair<std::size_t, double>> entries(triplets.size());
+    std::vector<std::size_t> next(mOuter.begin(), mOuter.end() - 1);
+    for (const Triplet& t : triplets)
+        entries[next[csr ? t.row : t.col]++] = { csr ? t.col : t.row, t.value };
+
+    mInner.reserve(entries.size());
+    mValues.reserve(entries.size());
+    std::size_t begin = 0;
+    for (std::size_t k = 0; k < outerSize(); ++k) {
+        const std::size_t end = mOuter[k + 1];
+        std::sort(entries.begin() + begin, entries.begin() + end,
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        mOuter[k] = mInner.size();
+        for (std::size_t p = begin; p < end; ++p) {
+            if (p > begin && entries[p].first == mInner.back())
+                mValues.back() += entries[p].second;
+            else {
+                mInner.push_back(entries[p].first);
+                mValues.push_back(entries[p].second);
+            }
+        }
+        begin = end;
+    }
+    mOuter[outerSize()] = mInner.size();
+}
+
+SparseMatrix::SparseMatrix(const Matrix& dense, Format format)
+    : SparseMatrix(dense.rows(), dense.cols(), Format::CSR)
+{
+    for (std::size_t i = 0; i < mRows; ++i) {
+        const double* a = dense.row(i);
+        for (std::size_t j = 0; j < mCols; ++j) {
+            if (a[j] != 0.0) {
+                mInner.push_back(j);
+                mValues.push_back(a[j]);
+            }
+        }
+        mOuter[i + 1] = mInner.size();
+    }
+    if (format == Format::CSC)
+        *this = converted();
+}
+
+std::size_t SparseMatrix::rows() const noexcept { return mRows; }
+std::size_t SparseMatrix::cols() const noexcept { return mCols; }
+std::size_t SparseMatrix::nonZeros() const noexcept { return mValues.size(); }
+SparseMatrix::Format SparseMatrix::format() const noexcept { return mFormat; }
+
+std::size_t SparseMatrix::outerSize() const noexcept {
+    return mFormat == Format::CSR ? mRows : mCols;
+}
+
+const std::vector<std::size_t>& SparseMatrix::outerIndex() const noexcept { return mOuter; }
+const std::vector<std::size_t>& SparseMatrix::innerIndex() const noexcept { return mInner; }
+const std::vector<double>&      SparseMatrix::values() const noexcept { return mValues; }
+
+// Counting-sort transpose of the compressed arrays; walking the source
+// slices in order leaves each destination slice sorted.
+SparseMatrix SparseMatrix::converted() const {
+    SparseMatrix out(mRows, mCols, mFormat == Format::CSR ? Format::CSC : Format::CSR);
+    for (std::size_t i : mInner)
+        ++out.mOuter[i + 1];
+    for (std::size_t k = 0; k + 1 < out.mOuter.size(); ++k)
+        out.mOuter[k + 1] += out.mOuter[k];
+    out.mInner.resize(mInner.size());
+    out.mValues.resize(mValues.size());
+    std::vector<std::size_t> next(out.mOuter.begin(), out.mOuter.end() - 1);
+    for (std::size_t k = 0; k < outerSize(); ++k) {
+        for (std::size_t p = mOuter[k]; p < mOuter[k + 1]; ++p) {
+            const std::size_t q = next[mInner[p]]++;
+            out.mInner[q]  = k;
+            out.mValues[q] = mValues[p];
+        }
+    }
+    return out;
+}
+
+SparseMatrix SparseMatrix::toCSR() const {
+    return mFormat == Format::CSR ? *this : converted();
+}
+
+SparseMatrix SparseMatrix::toCSC() const {
+    return mFormat == Format::CSC ? *this : converted();
+}
+
+Matrix SparseMatrix::toDense() const {
+    Matrix D(mRows, mCols);
+    const bool csr = mFormat == Format::CSR;
+    for (std::size_t k = 0; k < outerSize(); ++k) {
+        for (std::size_t p = mOuter[k]; p < mOuter[k + 1]; ++p) {
+            if (csr) D.row(k)[mInner[p]] = mValues[p];
+            else     D.row(mInner[p])[k] = mValues[p];
+        }
+    }
+    return D;
+}
+
+double SparseMatrix::coeff(std::size_t i, std::size_t j) const {
+    if (i >= mRows || j >= mCols)
+        throw std::out_of_range("Sparse index out of range");
+    const std::size_t k = mFormat == Format::CSR ? i : j;
+    const std::size_t t = mFormat == Format::CSR ? j : i;
+    const auto first = mInner.begin() + static_cast<std::ptrdiff_t>(mOuter[k]);
+    const auto last  = mInner.begin() + static_cast<std::ptrdiff_t>(mOuter[k + 1]);
+    const auto it = std::lower_bound(first, last, t);
+    if (it == last || *it != t)
+        return 0.0;
+    return mValues[static_cast<std::size_t>(it - mInner.begin())];
+}
+
+Vector SparseMatrix::diagonal() const {
+    Vector d(std::min(mRows, mCols));
+    for (std::size_t i = 0; i < d.size(); ++i)
+        d[i] = coeff(i, i);
+    return d;
+}
+
+void SparseMatrix::multiply(const Vector& x, Vector& y) const {
+    std::vector<double> scratch;
+    multiply(x, y, scratch);
+}
+
+void SparseMatrix::multiply(const Vector& x, Vector& y, std::vector<double>& scratch) const {
+    if (x.size() != mCols)
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (y.size() != mRows)
+        throw std::length_error("Output vector has wrong size");
+    if (&x == &y)
+        throw std::invalid_argument("Output vector must not alias the input");
+    if (mFormat == Format::CSR)
+        gather(mOuter, mInner, mValues, x.data(), y.data());
+    else
+        scatter(mOuter, mInner, mValues, x.data(), y.data(), mRows, scratch);
+}
+
+void SparseMatrix::transposeMultiply(const Vector& x, Vector& y) const {
+    std::vector<double> scratch;
+    transposeMultiply(x, y, scratch);
+}
+
+void SparseMatrix::transposeMultiply(const Vector& x, Vector& y, std::vector<double>& scratch) const {
+    if (x.size() != mRows)
+        throw std::length_error("Matrix/vector dimensions must agree");
+    if (y.size() != mCols)
+        throw std::length_error("Output vector has wrong size");
+    if (&x == &y)
+        throw std::invalid_argument("Output vector must not alias the input");
+    if (mFormat == Format::CSC)
+        gather(mOuter, mInner, mValues, x.data(), y.data());
+    else
+        scatter(mOuter, mInner, mValues, x.data(), y.data(), mCols, scratch);
+}
+
+Vector SparseMatrix::operator*(const Vector& x) const {
+    Vector y(mRows);
+    multiply(x, y);
+    return y;
+}
+
+SparseOperator::SparseOperator(const SparseMatrix& A) noexcept : mA(A) {}
+
+std::size_t SparseOperator::rows() const noexcept { return mA.rows(); }
+std::size_t SparseOperator::cols() const noexcept { return mA.cols(); }
+
+void SparseOperator::apply(const Vector& x, Vector& y) const {
+    mA.multiply(x, y, mScratch);
+}
+
+void SparseOperator::applyTranspose(const Vector& x, Vector& y) const {
+    mA.transposeMultiply(x, y, mScratch);
+}
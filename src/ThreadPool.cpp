@@ -0,0 +1,206 @@
+// src/ThreadPool.cpp
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+
+namespace {
+
+// Identifies the pool (and home queue) of the current worker thread.
+thread_local const ThreadPool* tlsPool  = nullptr;
+thread_local std::size_t       tlsIndex = 0;
+
+std::size_t defaultThreadCount() {
+    if (const char* env = std::getenv("LINALG_NUM_THREADS")) {
+        char* end = nullptr;
+        const unsigned long n = std::strtoul(env, &end, 10);
+        if (end != env && n > 0)
+            return static_cast<std::size_t>(n);
+    }
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw ? hw : 1;
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threads)
+    : mPending(0), mNextQueue(0), mStopping(false)
+{
+    if (threads == 0)
+        throw std::invalid_argument("ThreadPool needs at least one thread");
+    start(threads - 1);
+}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+ThreadPool& ThreadPool::instance() {
+    static ThreadPool pool(defaultThreadCount());
+    return pool;
+}
+
+std::size_t ThreadPool::size() const noexcept {
+    return mWorkers.size() + 1;
+}
+
+void ThreadPool::resize(std::size_t threads) {
+    if (threads == 0)
+        throw std::invalid_argument("ThreadPool needs at least one thread");
+    if (threads == size())
+        return;
+    stop();
+    start(threads - 1);
+}
+
+void ThreadPool::start(std::size_t workers) {
+    mStopping  = false;
+    mPending   = 0;
+    mNextQueue = 0;
+    mQueues.clear();
+    for (std::size_t i = 0; i < workers; ++i)
+        mQueues.push_back(std::make_unique<Queue>());
+    for (std::size_t i = 0; i < workers; ++i)
+        mWorkers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+void ThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStopping = true;
+    }
+    mWake.notify_all();
+    for (auto& t : mWorkers)
+        t.join();
+    mWorkers.clear();
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    if (mWorkers.empty()) {
+        task();
+        return;
+    }
+    {
+        // Queue choice, push and pending count change together, so a worker
+        // that pops the task early still sees a consistent mPending.
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        const std::size_t q = tlsPool == this ? tlsIndex
+                                              : mNextQueue++ % mQueues.size();
+        {
+            std::lock_guard<std::mutex> qlock(mQueues[q]->mutex);
+            mQueues[q]->tasks.push_back(std::move(task));
+        }
+        ++mPending;
+    }
+    mWake.notify_one();
+}
+
+bool ThreadPool::tryRun(std::size_t home) {
+    std::function<void()> task;
+    {
+        Queue& own = *mQueues[home];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (std::size_t off = 1; !task && off < mQueues.size(); ++off) {
+        Queue& victim = *mQueues[(home + off) % mQueues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        --mPending;
+    }
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    tlsPool  = this;
+    tlsIndex = index;
+    for (;;) {
+        if (tryRun(index))
+            continue;
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mWake.wait(lock, [this] { return mPending > 0 || mStopping; });
+        if (mStopping && mPending == 0)
+            return;
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t first, std::size_t last, std::size_t grain,
+                             const RangeFn& fn)
+{
+    if (last <= first)
+        return;
+    if (grain == 0)
+        grain = 1;
+    const std::size_t chunks = chunkCount(last - first, grain);
+
+    if (chunks == 1 || mWorkers.empty()) {
+        for (std::size_t b = first; b < last; b += grain)
+            fn(b, std::min(b + grain, last));
+        return;
+    }
+
+    struct Job {
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+        std::atomic<bool>        failed{false};
+        std::exception_ptr       error;
+        std::mutex               mutex;
+        std::condition_variable  finished;
+    };
+    auto job = std::make_shared<Job>();
+
+    // Helpers that start after every chunk is claimed return immediately, so
+    // capturing fn by reference is safe even if they outlive this call.
+    auto work = [job, first, last, grain, chunks, &fn] {
+        std::size_t c;
+        while ((c = job->next.fetch_add(1)) < chunks) {
+            if (!job->failed.load()) {
+                const std::size_t b = first + c * grain;
+                try {
+                    fn(b, std::min(b + grain, last));
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(job->mutex);
+                    if (!job->error)
+                        job->error = std::current_exception();
+                    job->failed = true;
+                }
+            }
+            if (job->done.fetch_add(1) + 1 == chunks) {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->finished.notify_all();
+            }
+        }
+    };
+
+    const std::size_t helpers = std::min(chunks, size()) - 1;
+    for (std::size_t h = 0; h < helpers; ++h)
+        submit(work);
+    work();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&] { return job->done.load() == chunks; });
+    if (job->error)
+        std::rethrow_exception(job->error);
+}
+
+void setNumThreads(std::size_t threads) {
+    ThreadPool::instance().resize(threads);
+}
+
+std::size_t numThreads() noexcept {
+    return ThreadPool::instance().size();
+}
@@ -3,81 +3,119 @@
 #include <algorithm>
 #include <stdexcept>
 
+namespace {
+
+double* allocate(MemoryResource* resource, std::size_t count) {
+    return static_cast<double*>(resource->allocate(count * sizeof(double)));
+}
+
+void deallocate(MemoryResource* resource, double* p, std::size_t count) noexcept {
+    if (p)
+        resource->deallocate(p, count * sizeof(double));
+}
+
+} // namespace
+
 Vector::Vector(std::size_t size)
-    : mSize(size),
-      mData(new double[size]())
+    : Vector(size, Uninitialized{})
+{
+    std::fill(mData, mData + mSize, 0.0);
+}
+
+Vector::Vector(std::size_t size, Uninitialized)
+    : mSize(size), mResource(currentResource()), mData(allocate(mResource, size))
 {}
 
 Vector::Vector(const Vector& other)
-    : mSize(other.mSize),
-      mData(new double[other.mSize])
+    : Vector(other.mSize, Uninitialized{})
 {
     std::copy(other.mData, other.mData + mSize, mData);
 }
 
+Vector::Vector(Vector&& other) noexcept
+    : mSize(other.mSize),
+      mResource(other.mResource),
+      mData(other.mData)
+{
+    other.mSize = 0;
+    other.mData = nullptr;
+}
+
 Vector::~Vector() {
-    delete[] mData;
+    deallocate(mResource, mData, mSize);
 }
 
+// Like std::pmr containers, assignment keeps this vector's resource.
 Vector& Vector::operator=(const Vector& other) {
     if (this != &other) {
         if (mSize != other.mSize) {
-            delete[] mData;
+            double* data = allocate(mResource, other.mSize);
+            deallocate(mResource, mData, mSize);
             mSize = other.mSize;
-            mData = new double[mSize];
+            mData = data;
         }
         std::copy(other.mData, other.mData + mSize, mData);
     }
     return *this;
 }
 
-Vector Vector::operator+() const {
+Vector& Vector::operator=(Vector&& other) {
+    // A buffer from another resource may not outlive it (an arena scope).
+    if (mResource != other.mResource)
+        return *this = other;
+    if (this != &other) {
+        deallocate(mResource, mData, mSize);
+        mSize = other.mSize;
+        mData = other.mData;
+        other.mSize = 0;
+        other.mData = nullptr;
+    }
     return *this;
 }
 
-Vector Vector::operator-() const {
-    Vector tmp(*this);
-    for (std::size_t i = 0; i < mSize; ++i)
-        tmp.mData[i] = -tmp.mData[i];
-    return tmp;
-}
-
-Vector Vector::operator+(const Vector& rhs) const {
+Vector& Vector::operator+=(const Vector& rhs) {
     if (rhs.mSize != mSize)
         throw std::length_error("Vector size mismatch in addition");
-    Vector out(mSize);
     for (std::size_t i = 0; i < mSize; ++i)
-        out.mData[i] = mData[i] + rhs.mData[i];
-    return out;
+        mData[i] += rhs.mData[i];
+    return *this;
 }
 
-Vector Vector::operator*(double scalar) const {
-    Vector out(mSize);
+Vector& Vector::operator-=(const Vector& rhs) {
+    if (rhs.mSize != mSize)
+        throw std::length_error("Vector size mismatch in subtraction");
     for (std::size_t i = 0; i < mSize; ++i)
-        out.mData[i] = mData[i] * scalar;
-    return out;
-}
-
-double& Vector::operator[](std::size_t idx) {
-    if (idx >= mSize) throw std::out_of_range("Vector index out of range");
-    return mData[idx];
+        mData[i] -= rhs.mData[i];
+    return *this;
 }
 
-const double& Vector::operator[](std::size_t idx) const {
-    if (idx >= mSize) throw std::out_of_range("Vector index out of range");
-    return mData[idx];
+Vector& Vector::operator*=(double scalar) {
+    for (std::size_t i = 0; i < mSize; ++i)
+        mData[i] *= scalar;
+    return *this;
 }
 
-double& Vector::operator()(std::size_t idx) {
-    if (idx == 0 || idx > mSize) throw std::out_of_range("Vector 1-based index out of range");
-    return mData[idx - 1];
+Vector& Vector::axpy(double alpha, const Vector& x) {
+    if (x.mSize != mSize)
+        throw std::length_error("Vector size mismatch in axpy");
+    for (std::size_t i = 0; i < mSize; ++i)
+        mData[i] += alpha * x.mData[i];
+    return *this;
 }
 
-const double& Vector::operator()(std::size_t idx) const {
-    if (idx == 0 || idx > mSize) throw std::out_of_range("Vector 1-based index out of range");
-    return mData[idx - 1];
+Vector& Vector::axpby(double alpha, const Vector& x, double beta) {
+    if (x.mSize != mSize)
+        throw std::length_error("Vector size mismatch in axpby");
+    for (std::size_t i = 0; i < mSize; ++i)
+        mData[i] = alpha * x.mData[i] + beta * mData[i];
+    return *this;
 }
 
-std::size_t Vector::size() const noexcept {
-    return mSize;
+double Vector::dot(const Vector& rhs) const {
+    if (rhs.mSize != mSize)
+        throw std::length_error("Vector size mismatch in dot product");
+    double sum = 0.0;
+    for (std::size_t i = 0; i < mSize; ++i)
+        sum += mData[i] * rhs.mData[i];
+    return sum;
 }
@@ -0,0 +1,78 @@
+// tests/TestData.hpp
+#ifndef TESTDATA_HPP
+#define TESTDATA_HPP
+
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "Blas.hpp"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+/** Deterministic inputs shared by the unit tests. */
+namespace testdata {
+
+/** rows×cols matrix with entries uniform in [-1, 1], drawn from @p rng. */
+inline Matrix randomMatrix(std::size_t rows, std::size_t cols, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix M(rows, cols);
+    for (double& v : M) v = dist(rng);
+    return M;
+}
+
+inline Matrix randomMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+    std::mt19937 rng(seed);
+    return randomMatrix(rows, cols, rng);
+}
+
+/** Vector with entries uniform in [-1, 1], drawn from @p rng. */
+inline Vector randomVector(std::size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Vector v(n);
+    for (double& x : v) x = dist(rng);
+    return v;
+}
+
+inline Vector randomVector(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    return randomVector(n, rng);
+}
+
+/** Well-conditioned symmetric positive-definite n×n matrix BᵀB + n·I. */
+inline Matrix randomSpd(std::size_t n, std::mt19937& rng) {
+    const Matrix B = randomMatrix(n, n, rng);
+    Matrix A(n, n);
+    gemm(Transpose::Yes, Transpose::No, 1.0, B, B, 0.0, A);
+    for (std::size_t i = 0; i < n; ++i)
+        A.row(i)[i] += double(n);
+    return A;
+}
+
+inline Matrix randomSpd(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    return randomSpd(n, rng);
+}
+
+/**
+ * @p m rows of y = X·beta + noise·N(0, 1). X has beta.size() columns: the
+ * last is the intercept (all ones), the others are standard normal.
+ */
+inline void syntheticData(std::size_t m, const std::vector<double>& beta, double noise,
+                          unsigned seed, Matrix& X, Vector& y) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> dist(0.0, 1.0);
+    const std::size_t p = beta.size();
+    X = Matrix(m, p);
+    y = Vector(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        double* xi = X.row(i);
+        for (std::size_t j = 0; j + 1 < p; ++j) xi[j] = dist(rng);
+        xi[p - 1] = 1.0;
+        y[i] = noise * dist(rng);
+        for (std::size_t j = 0; j < p; ++j) y[i] += beta[j] * xi[j];
+    }
+}
+
+} // namespace testdata
+
+#endif // TESTDATA_HPP
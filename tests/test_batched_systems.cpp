@@ -0,0 +1,110 @@
+// tests/test_batched_systems.cpp
+#include <catch2/catch.hpp>
+#include <random>
+#include <stdexcept>
+#include "BatchedSystems.hpp"
+#include "Factorization.hpp"
+#include "TestData.hpp"
+
+TEST_CASE("Batched Cholesky matches per-system solves", "[Batched]") {
+    std::mt19937 rng(1);
+    const std::size_t n = 7, count = 1003;   // not a multiple of kLanes
+    BatchedSystems batch(n, count);
+    REQUIRE(batch.stride() % BatchedSystems::kLanes == 0);
+    std::vector<Vector> expected;
+    for (std::size_t s = 0; s < count; ++s) {
+        Matrix A = testdata::randomSpd(n, rng);
+        Vector b = testdata::randomVector(n, rng);
+        batch.setSystem(s, A, b);
+        expected.push_back(CholeskyFactorization(A).solve(b));
+    }
+    REQUIRE(batch.solveCholesky() == 0);
+    for (std::size_t s = 0; s < count; s += 37) {
+        REQUIRE(batch.succeeded(s));
+        Vector x = batch.solution(s);
+        for (std::size_t i = 0; i < n; ++i)
+            REQUIRE(x[i] == Approx(expected[s][i]).epsilon(1e-10));
+    }
+}
+
+TEST_CASE("Batched LU pivots independently per system", "[Batched]") {
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    const std::size_t n = 5, count = 20;
+    BatchedSystems batch(n, count);
+    std::vector<Vector> expected;
+    for (std::size_t s = 0; s < count; ++s) {
+        Matrix A(n, n);
+        for (double& v : A) v = dist(rng);
+        A(1, 1) = 0.0;   // forces a row swap in every system
+        Vector b = testdata::randomVector(n, rng);
+        batch.setSystem(s, A, b);
+        expected.push_back(LUFactorization(A).solve(b));
+    }
+    REQUIRE(batch.solveLU() == 0);
+    for (std::size_t s = 0; s < count; ++s) {
+        Vector x = batch.solution(s);
+        for (std::size_t i = 0; i < n; ++i)
+            REQUIRE(x[i] == Approx(expected[s][i]).epsilon(1e-9));
+    }
+}
+
+TEST_CASE("Batched LU accepts uniformly scaled-down systems", "[Batched]") {
+    std::mt19937 rng(4);
+    const std::size_t n = 7, count = BatchedSystems::kLanes;
+    BatchedSystems batch(n, count);
+    std::vector<Vector> expected;
+    for (std::size_t s = 0; s < count; ++s) {
+        Matrix A = testdata::randomMatrix(n, n, rng);
+        for (double& v : A) v *= 1e-13 * double(s + 1);   // entries ~1e-13, nonsingular
+        Vector b = testdata::randomVector(n, rng);
+        batch.setSystem(s, A, b);
+        expected.push_back(LUFactorization(A).solve(b));
+    }
+    REQUIRE(batch.solveLU() == 0);
+    for (std::size_t s = 0; s < count; ++s) {
+        REQUIRE(batch.succeeded(s));
+        Vector x = batch.solution(s);
+        for (std::size_t i = 0; i < n; ++i)
+            REQUIRE(x[i] == Approx(expected[s][i]).epsilon(1e-9));
+    }
+}
+
+TEST_CASE("Batched solvers flag bad systems without disturbing others", "[Batched]") {
+    std::mt19937 rng(3);
+    const std::size_t n = 3;
+    BatchedSystems batch(n, 4);
+    Matrix good = testdata::randomSpd(n, rng);
+    Vector b = testdata::randomVector(n, rng);
+    Matrix indefinite(n, n);
+    indefinite(1, 1) = 1.0; indefinite(2, 2) = -1.0; indefinite(3, 3) = 1.0;
+    for (std::size_t s = 0; s < 4; ++s)
+        batch.setSystem(s, s == 2 ? indefinite : good, b);
+    REQUIRE(batch.solveCholesky() == 1);
+    REQUIRE_FALSE(batch.succeeded(2));
+    REQUIRE(batch.succeeded(3));
+    Vector expected = CholeskyFactorization(good).solve(b);
+    REQUIRE(batch.solution(3)[0] == Approx(expected[0]));
+
+    BatchedSystems singular(2, 1);
+    REQUIRE(singular.solveLU() == 1);   // all-zero system
+    REQUIRE_THROWS_AS(singular.setSystem(1, Matrix(2, 2), Vector(2)), std::out_of_range);
+    REQUIRE_THROWS_AS(singular.setSystem(0, Matrix(3, 3), Vector(3)), std::length_error);
+}
+
+TEST_CASE("Batched buffers use the documented interleaved layout", "[Batched]") {
+    BatchedSystems batch(2, 3);
+    const std::size_t st = batch.stride();
+    // System s: diag(s + 1, 2), b = (s + 1, 4)  ->  x = (1, 2).
+    for (std::size_t s = 0; s < 3; ++s) {
+        batch.A()[(0 * 2 + 0) * st + s] = double(s + 1);
+        batch.A()[(1 * 2 + 1) * st + s] = 2.0;
+        batch.b()[0 * st + s] = double(s + 1);
+        batch.b()[1 * st + s] = 4.0;
+    }
+    REQUIRE(batch.solveCholesky() == 0);
+    for (std::size_t s = 0; s < 3; ++s) {
+        REQUIRE(batch.solution(s)[0] == Approx(1.0));
+        REQUIRE(batch.solution(s)[1] == Approx(2.0));
+    }
+}
@@ -0,0 +1,129 @@
+// tests/test_binary_dataset.cpp
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "BinaryDataset.hpp"
+
+namespace {
+
+std::string tempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+CsvSchema machineSchema() {
+    CsvSchema s;
+    s.columns = { ColumnRole::Ignore, ColumnRole::Ignore,
+                  ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                  ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                  ColumnRole::Target, ColumnRole::Ignore };
+    s.intercept = true;
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("Binary dataset round-trips values and names", "[Binary]") {
+    Matrix X(5, 3);
+    Vector y(5);
+    for (std::size_t i = 0; i < 5; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) X.row(i)[j] = double(10 * i + j) + 0.25;
+        y[i] = -double(i);
+    }
+    const std::string path = tempPath("linalg_roundtrip.bin");
+    writeBinaryDataset(path, X, Span<const double>(y.data(), y.size()),
+                       { "a", "bb", "" }, "target");
+    REQUIRE(isBinaryDataset(path));
+
+    BinaryDataset bin(path);
+    REQUIRE(bin.rows() == 5);
+    REQUIRE(bin.cols() == 3);
+    MatrixView V = bin.features();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(V.data()) % 64 == 0);
+    for (std::size_t i = 0; i < 5; ++i) {
+        REQUIRE(bin.target()[i] == y[i]);
+        for (std::size_t j = 0; j < 3; ++j)
+            REQUIRE(V.row(i)[j] == X.row(i)[j]);
+    }
+    REQUIRE(V(2, 3) == X(2, 3));
+    REQUIRE(bin.featureNames() == std::vector<std::string>{ "a", "bb", "" });
+    REQUIRE(bin.targetName() == "target");
+
+    Matrix copy = V.toMatrix();
+    REQUIRE(copy(5, 1) == X(5, 1));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CSV converts to the same data readCsv produces", "[Binary]") {
+    const std::string path = tempPath("linalg_machine.bin");
+    convertCsvToBinary("data/machine.data", machineSchema(), path);
+    Dataset csv = readCsv("data/machine.data", machineSchema());
+    BinaryDataset bin(path);
+    REQUIRE(bin.rows() == csv.X.rows());
+    REQUIRE(bin.cols() == 7);
+    for (std::size_t i = 0; i < bin.rows(); ++i) {
+        REQUIRE(bin.target()[i] == csv.y[i]);
+        for (std::size_t j = 0; j < 7; ++j)
+            REQUIRE(bin.features().row(i)[j] == csv.X.row(i)[j]);
+    }
+    REQUIRE_FALSE(isBinaryDataset("data/machine.data"));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Converter takes column names from a CSV header", "[Binary]") {
+    const std::string csv = tempPath("linalg_header.csv");
+    const std::string bin = tempPath("linalg_header.bin");
+    {
+        std::ofstream out(csv);
+        out << "id,x,y\nfoo,1,2\nbar,3,4\n";
+    }
+    CsvSchema s;
+    s.columns = { ColumnRole::Ignore, ColumnRole::Feature, ColumnRole::Target };
+    s.header = true;
+    s.intercept = true;
+    convertCsvToBinary(csv, s, bin);
+    BinaryDataset d(bin);
+    REQUIRE(d.rows() == 2);
+    REQUIRE(d.featureNames() == std::vector<std::string>{ "x", "intercept" });
+    REQUIRE(d.targetName() == "y");
+    REQUIRE(d.features()(2, 1) == 3.0);
+    REQUIRE(d.target()[1] == 4.0);
+    std::filesystem::remove(csv);
+    std::filesystem::remove(bin);
+}
+
+TEST_CASE("Malformed binary datasets are rejected", "[Binary]") {
+    const std::string path = tempPath("linalg_bad.bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "LADSBIN1 but truncated";
+    }
+    REQUIRE_THROWS_AS(BinaryDataset(path), std::runtime_error);
+
+    Matrix X(100, 2);
+    Vector y(100);
+    writeBinaryDataset(path, X, Span<const double>(y.data(), y.size()));
+    std::filesystem::resize_file(path, 200);   // cut into the feature block
+    REQUIRE_THROWS_AS(BinaryDataset(path), std::runtime_error);
+    REQUIRE_THROWS_AS(BinaryDataset("data/machine.data"), std::runtime_error);
+    REQUIRE_THROWS_AS(writeBinaryDataset(path, X, Span<const double>(y.data(), 3)),
+                      std::length_error);
+
+    // Header fields whose section sizes wrap around in 64 bits.
+    auto patched = [&](std::streamoff offset, std::uint64_t a, std::uint64_t b) {
+        writeBinaryDataset(path, X, Span<const double>(y.data(), y.size()));
+        std::fstream io(path, std::ios::in | std::ios::out | std::ios::binary);
+        io.seekp(offset);
+        io.write(reinterpret_cast<const char*>(&a), sizeof a);
+        io.write(reinterpret_cast<const char*>(&b), sizeof b);
+    };
+    patched(32, ~std::uint64_t(0) - 7, 16);          // namesOffset 2^64 - 8, namesBytes 16
+    REQUIRE_THROWS_AS(BinaryDataset(path), std::runtime_error);
+    patched(16, std::uint64_t(1) << 61, 0);          // rows 2^61, cols 0: 8·rows wraps to 0
+    REQUIRE_THROWS_AS(BinaryDataset(path), std::runtime_error);
+    patched(16, std::uint64_t(1) << 60, 2);          // rows·cols·8 wraps to 0
+    REQUIRE_THROWS_AS(BinaryDataset(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
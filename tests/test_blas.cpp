@@ -0,0 +1,155 @@
+// tests/test_blas.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Blas.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// Reference: C = alpha * op(A) * op(B) + beta * C with plain loops.
+void naiveGemm(bool ta, bool tb, double alpha, const Matrix& A, const Matrix& B,
+               double beta, Matrix& C) {
+    for (std::size_t i = 1; i <= C.rows(); ++i)
+        for (std::size_t j = 1; j <= C.cols(); ++j) {
+            double s = 0.0;
+            std::size_t k = ta ? A.rows() : A.cols();
+            for (std::size_t p = 1; p <= k; ++p)
+                s += (ta ? A(p,i) : A(i,p)) * (tb ? B(j,p) : B(p,j));
+            C(i,j) = alpha * s + beta * C(i,j);
+        }
+}
+
+double maxAbsDiff(const Matrix& X, const Matrix& Y) {
+    double d = 0.0;
+    for (std::size_t i = 0; i < X.rows(); ++i)
+        for (std::size_t j = 0; j < X.cols(); ++j)
+            d = std::max(d, std::abs(X.row(i)[j] - Y.row(i)[j]));
+    return d;
+}
+
+} // namespace
+
+TEST_CASE("gemm matches reference across blocking edges", "[Blas]") {
+    std::mt19937 rng(7);
+    // Shapes straddle the micro-tile and cache-block boundaries.
+    const std::size_t shapes[][3] = {
+        {1, 1, 1}, {3, 5, 2}, {17, 9, 33}, {64, 64, 64},
+        {197, 131, 260}, {45, 300, 7}
+    };
+    for (auto& s : shapes) {
+        const std::size_t m = s[0], n = s[1], k = s[2];
+        Matrix A = testdata::randomMatrix(m, k, rng);
+        Matrix B = testdata::randomMatrix(k, n, rng);
+        Matrix C = testdata::randomMatrix(m, n, rng);
+        Matrix R = C;
+        gemm(0.5, A, B, -2.0, C);
+        naiveGemm(false, false, 0.5, A, B, -2.0, R);
+        REQUIRE(maxAbsDiff(C, R) < 1e-10);
+    }
+}
+
+TEST_CASE("float gemm matches the double product across blocking edges", "[Blas]") {
+    std::mt19937 rng(11);
+    const std::size_t shapes[][3] = {{3, 5, 2}, {17, 9, 33}, {197, 131, 260}, {45, 300, 7}};
+    for (auto& s : shapes) {
+        const std::size_t m = s[0], n = s[1], k = s[2];
+        for (bool ta : {false, true}) {
+            Matrix A = ta ? testdata::randomMatrix(k, m, rng) : testdata::randomMatrix(m, k, rng);
+            Matrix B = testdata::randomMatrix(k, n, rng);
+            Matrix R = testdata::randomMatrix(m, n, rng);
+            std::vector<float> a(A.begin(), A.end()), b(B.begin(), B.end()), c(R.begin(), R.end());
+            gemm(ta ? Transpose::Yes : Transpose::No, Transpose::No, m, n, k,
+                 0.5f, a.data(), A.cols(), b.data(), n, -2.0f, c.data(), n);
+            naiveGemm(ta, false, 0.5, A, B, -2.0, R);
+            double d = 0.0;
+            for (std::size_t i = 0; i < m * n; ++i)
+                d = std::max(d, std::abs(c[i] - R.data()[i]));
+            REQUIRE(d < 1e-4);
+        }
+    }
+}
+
+TEST_CASE("gemm supports transposed operands", "[Blas]") {
+    std::mt19937 rng(11);
+    Matrix A = testdata::randomMatrix(70, 90, rng);   // used as Aᵀ: 90×70
+    Matrix B = testdata::randomMatrix(50, 70, rng);   // used as Bᵀ: 70×50
+    Matrix C(90, 50), R(90, 50);
+    gemm(Transpose::Yes, Transpose::Yes, 1.0, A, B, 0.0, C);
+    naiveGemm(true, true, 1.0, A, B, 0.0, R);
+    REQUIRE(maxAbsDiff(C, R) < 1e-10);
+}
+
+TEST_CASE("gemm with beta zero ignores existing output", "[Blas]") {
+    std::mt19937 rng(3);
+    Matrix A = testdata::randomMatrix(40, 40, rng), B = testdata::randomMatrix(40, 40, rng);
+    Matrix C(40, 40);
+    for (double& v : C) v = std::numeric_limits<double>::quiet_NaN();
+    gemm(1.0, A, B, 0.0, C);
+    REQUIRE(maxAbsDiff(C, A * B) < 1e-12);
+    REQUIRE(std::string(gemmKernelName()).size() > 0);
+}
+
+TEST_CASE("gemm validates shapes and aliasing", "[Blas]") {
+    Matrix A(2,3), B(3,2), C(2,2), bad(3,3);
+    REQUIRE_THROWS_AS(gemm(1.0, A, A, 0.0, C), std::length_error);
+    REQUIRE_THROWS_AS(gemm(1.0, A, B, 0.0, bad), std::length_error);
+    Matrix S(2,2);
+    REQUIRE_THROWS_AS(gemm(1.0, S, S, 0.0, S), std::invalid_argument);
+}
+
+TEST_CASE("gram matches XᵀX and Xᵀy for narrow and wide X", "[Blas]") {
+    std::mt19937 rng(17);
+    // Narrow X spans many row blocks; wide X goes through the gemm panels.
+    for (auto shape : { std::pair<std::size_t, std::size_t>{ 50000, 7 },
+                        std::pair<std::size_t, std::size_t>{ 9000, 150 } }) {
+        Matrix X = testdata::randomMatrix(shape.first, shape.second, rng);
+        Matrix Y = testdata::randomMatrix(shape.first, 1, rng);
+        Vector y(shape.first);
+        for (std::size_t i = 0; i < shape.first; ++i) y[i] = Y.row(i)[0];
+
+        const std::size_t n = shape.second;
+        Matrix G(n, n);
+        Vector g(n);
+        gram(X, y, G, g);
+
+        Matrix expectedG(n, n), expectedg(n, 1);
+        gemm(Transpose::Yes, Transpose::No, 1.0, X, X, 0.0, expectedG);
+        gemm(Transpose::Yes, Transpose::No, 1.0, X, Y, 0.0, expectedg);
+        REQUIRE(maxAbsDiff(G, expectedG) < 1e-8);
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(g[i] == Approx(expectedg.row(i)[0]).margin(1e-8));
+            for (std::size_t j = 0; j < n; ++j)
+                REQUIRE(G.row(i)[j] == G.row(j)[i]);
+        }
+    }
+}
+
+TEST_CASE("gram accumulates with beta and validates shapes", "[Blas]") {
+    std::mt19937 rng(18);
+    Matrix X1 = testdata::randomMatrix(300, 5, rng), X2 = testdata::randomMatrix(200, 5, rng);
+    Matrix X(500, 5);
+    Vector y(500), y1(300), y2(200);
+    for (std::size_t i = 0; i < 500; ++i) {
+        const double* src = i < 300 ? X1.row(i) : X2.row(i - 300);
+        std::copy(src, src + 5, X.row(i));
+        y[i] = double(i % 9) - 4.0;
+        (i < 300 ? y1[i] : y2[i - 300]) = y[i];
+    }
+    Matrix G(5, 5), Gfull(5, 5);
+    Vector g(5), gfull(5);
+    gram(X1, y1, G, g);
+    gram(X2, y2, 1.0, G, g);
+    gram(X, y, Gfull, gfull);
+    REQUIRE(maxAbsDiff(G, Gfull) < 1e-10);
+    for (std::size_t i = 0; i < 5; ++i)
+        REQUIRE(g[i] == Approx(gfull[i]));
+
+    Matrix wrong(4, 5);
+    REQUIRE_THROWS_AS(gram(X, y, wrong, g), std::length_error);
+    REQUIRE_THROWS_AS(gram(X, y1, G, g), std::length_error);
+}
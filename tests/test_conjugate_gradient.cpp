@@ -0,0 +1,171 @@
+// tests/test_conjugate_gradient.cpp
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <stdexcept>
+#include "ConjugateGradient.hpp"
+#include "LinearSystem.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// SPD matrix with row/column scales spread over several orders of magnitude.
+Matrix badlyScaledSpd(std::size_t n, unsigned seed) {
+    Matrix A = testdata::randomSpd(n, seed);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double si = std::pow(10.0, double(i % 4));
+        for (std::size_t j = 0; j < n; ++j)
+            A.row(i)[j] *= si * std::pow(10.0, double(j % 4));
+    }
+    return A;
+}
+
+// Tridiagonal 1-D Laplacian: sparse pattern, so IC(0) differs from Cholesky.
+Matrix laplacian(std::size_t n) {
+    Matrix A(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        A.row(i)[i] = 2.0;
+        if (i > 0)     A.row(i)[i - 1] = -1.0;
+        if (i + 1 < n) A.row(i)[i + 1] = -1.0;
+    }
+    return A;
+}
+
+double residual(const Matrix& A, const Vector& x, const Vector& b) {
+    Vector r = A * x;
+    r -= b;
+    return std::sqrt(r.dot(r));
+}
+
+Vector ones(std::size_t n) {
+    Vector v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = 1.0;
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("CG honours relative tolerance and reports convergence", "[CG]") {
+    Matrix A = laplacian(50);
+    Vector b = ones(50);
+    CGOptions opts;
+    opts.relTol = 1e-12;
+    ConjugateGradient cg(A, opts);
+    Vector x(50);
+    CGResult res = cg.solve(b, x);
+    REQUIRE(res.converged);
+    REQUIRE(res.iterations <= 50);
+    REQUIRE(res.residualNorm <= 1e-12 * std::sqrt(b.dot(b)));
+    REQUIRE(residual(A, x, b) == Approx(res.residualNorm).margin(1e-10));
+}
+
+TEST_CASE("CG stops at maxIter without converging", "[CG]") {
+    Matrix A = laplacian(50);
+    Vector b = ones(50);
+    CGOptions opts;
+    opts.maxIter = 3;
+    Vector x(50);
+    CGResult res = ConjugateGradient(A, opts).solve(b, x);
+    REQUIRE_FALSE(res.converged);
+    REQUIRE(res.iterations == 3);
+}
+
+TEST_CASE("CG warm start from the solution takes no iterations", "[CG]") {
+    Matrix A = laplacian(20);
+    Vector b = ones(20);
+    ConjugateGradient cg(A);
+    Vector x(20);
+    REQUIRE(cg.solve(b, x).converged);
+
+    CGOptions loose;
+    loose.relTol = 1e-8;
+    cg.setOptions(loose);
+    CGResult again = cg.solve(b, x);
+    REQUIRE(again.converged);
+    REQUIRE(again.iterations == 0);
+}
+
+TEST_CASE("Preconditioners cut iterations on badly scaled systems", "[CG]") {
+    const std::size_t n = 60;
+    Matrix A = badlyScaledSpd(n, 7);
+    Vector b = ones(n);
+    CGOptions opts;
+    opts.relTol = 1e-10;
+
+    Vector x0(n);
+    CGResult plain = ConjugateGradient(A, opts).solve(b, x0);
+
+    JacobiPreconditioner jacobi(A);
+    Vector x1(n);
+    CGResult withJacobi = ConjugateGradient(A, opts, &jacobi).solve(b, x1);
+    REQUIRE(withJacobi.converged);
+    REQUIRE(withJacobi.iterations < plain.iterations);
+
+    // Dense A: IC(0) is the exact factor, so one iteration suffices.
+    IncompleteCholeskyPreconditioner ic(A);
+    Vector x2(n);
+    CGResult withIc = ConjugateGradient(A, opts, &ic).solve(b, x2);
+    REQUIRE(withIc.converged);
+    REQUIRE(withIc.iterations <= 2);
+    for (std::size_t i = 0; i < n; ++i)
+        REQUIRE(x2[i] == Approx(x1[i]).epsilon(1e-6));
+}
+
+TEST_CASE("Incomplete Cholesky keeps the sparsity pattern", "[CG]") {
+    Matrix A = laplacian(100);
+    Vector b = ones(100);
+    IncompleteCholeskyPreconditioner ic(A);
+    Vector x(100);
+    CGResult res = ConjugateGradient(A, CGOptions(), &ic).solve(b, x);
+    REQUIRE(res.converged);
+    REQUIRE(residual(A, x, b) < 1e-8);
+}
+
+TEST_CASE("Preconditioners reject unusable matrices", "[CG]") {
+    Matrix Z(2, 2);
+    Z(1, 2) = 1.0; Z(2, 1) = 1.0;
+    REQUIRE_THROWS_AS(JacobiPreconditioner(Z), std::invalid_argument);
+    Matrix indefinite(2, 2);
+    indefinite(1, 1) = 1.0; indefinite(1, 2) = 2.0;
+    indefinite(2, 1) = 2.0; indefinite(2, 2) = 1.0;
+    REQUIRE_THROWS_AS(IncompleteCholeskyPreconditioner(indefinite), std::runtime_error);
+}
+
+TEST_CASE("Preconditioners of the wrong size are rejected", "[CG]") {
+    const std::size_t n = 5;
+    Matrix A = laplacian(n);
+    JacobiPreconditioner small(ones(3));
+    IncompleteCholeskyPreconditioner ic(laplacian(4));
+    REQUIRE(small.size() == 3);
+    REQUIRE(ic.size() == 4);
+    REQUIRE_THROWS_AS(ConjugateGradient(A, CGOptions(), &small), std::length_error);
+    REQUIRE_THROWS_AS(ConjugateGradient(A, CGOptions(), &ic), std::length_error);
+    Vector b = ones(n);
+    PosSymLinSystem system(A, b, CGOptions(), &small);
+    REQUIRE_THROWS_AS(system.Solve(), std::length_error);
+
+    // Direct calls check both vectors.
+    Vector r = ones(n), z(n);
+    REQUIRE_THROWS_AS(small.apply(r, z), std::length_error);
+    Vector z3(3);
+    REQUIRE_THROWS_AS(small.apply(ones(3), z), std::length_error);
+    small.apply(ones(3), z3);
+    REQUIRE(z3[2] == 1.0);
+}
+
+TEST_CASE("PosSymLinSystem accepts options, preconditioner and warm start", "[CG]") {
+    Matrix A = laplacian(30);
+    Vector b = ones(30);
+    JacobiPreconditioner jacobi(A);
+    CGOptions opts;
+    opts.relTol = 1e-12;
+    PosSymLinSystem sys(A, b, opts, &jacobi);
+    REQUIRE(sys.options().relTol == 1e-12);
+
+    Vector x(30);
+    CGResult res = sys.Solve(x);
+    REQUIRE(res.converged);
+    Vector y = sys.Solve();
+    for (std::size_t i = 0; i < 30; ++i)
+        REQUIRE(y[i] == Approx(x[i]));
+    REQUIRE(sys.Solve(x).iterations == 0);
+}
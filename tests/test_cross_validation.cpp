@@ -0,0 +1,113 @@
+// tests/test_cross_validation.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "CrossValidation.hpp"
+#include "LinearSystem.hpp"
+#include "TestData.hpp"
+#include "ThreadPool.hpp"
+
+namespace {
+
+// y = X·[2, -1, 0.5, 4] + noise, last column is the intercept.
+const std::vector<double> kBeta = { 2.0, -1.0, 0.5, 4.0 };
+
+Span<const double> span(const Vector& v) { return Span<const double>(v.data(), v.size()); }
+
+} // namespace
+
+TEST_CASE("Cross-validation matches refitting every fold", "[CrossValidation]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(503, kBeta, 0.3, 1, X, y);   // folds of unequal size
+
+    CrossValidationOptions options;
+    options.folds = 5;
+    options.seeds = { 7, 11 };
+    CrossValidationResult cv = crossValidate(X, span(y), options);
+    REQUIRE(cv.folds.size() == 10);
+
+    for (const FoldScore& score : cv.folds) {
+        std::vector<std::size_t> order(503);
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::mt19937 rng(score.seed);
+        std::shuffle(order.begin(), order.end(), rng);
+        const std::size_t lo = score.fold * 503 / 5, hi = (score.fold + 1) * 503 / 5;
+
+        Matrix Xtr(503 - (hi - lo), 4);
+        Vector ytr(503 - (hi - lo));
+        for (std::size_t r = 0, i = 0; r < 503; ++r) {
+            if (r >= lo && r < hi) continue;
+            std::copy(X.row(order[r]), X.row(order[r]) + 4, Xtr.row(i));
+            ytr[i++] = y[order[r]];
+        }
+        Vector beta = LeastSquaresSystem(Xtr, ytr).Solve();
+
+        double sse = 0.0;
+        for (std::size_t r = lo; r < hi; ++r) {
+            const double err = X.row(order[r])[0] * beta[0] + X.row(order[r])[1] * beta[1]
+                             + X.row(order[r])[2] * beta[2] + X.row(order[r])[3] * beta[3]
+                             - y[order[r]];
+            sse += err * err;
+        }
+        double trainSse = 0.0;
+        for (std::size_t i = 0; i < Xtr.rows(); ++i) {
+            double err = -ytr[i];
+            for (std::size_t j = 0; j < 4; ++j) err += Xtr.row(i)[j] * beta[j];
+            trainSse += err * err;
+        }
+        REQUIRE(score.testRows == hi - lo);
+        REQUIRE(score.trainRows == 503 - (hi - lo));
+        REQUIRE(score.testRmse == Approx(std::sqrt(sse / double(hi - lo))));
+        REQUIRE(score.trainRmse == Approx(std::sqrt(trainSse / double(Xtr.rows()))));
+    }
+}
+
+TEST_CASE("Cross-validation summaries and thread independence", "[CrossValidation]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(400, kBeta, 0.3, 2, X, y);
+    CrossValidationOptions options;
+    options.folds = 4;
+    options.seeds = { 1, 2, 3 };
+
+    const std::size_t saved = numThreads();
+    setNumThreads(1);
+    CrossValidationResult one = crossValidate(X, span(y), options);
+    setNumThreads(4);
+    CrossValidationResult four = crossValidate(X, span(y), options);
+    setNumThreads(saved);
+    for (std::size_t t = 0; t < one.folds.size(); ++t) {
+        REQUIRE(one.folds[t].testRmse == four.folds[t].testRmse);
+        REQUIRE(one.folds[t].trainRmse == four.folds[t].trainRmse);
+    }
+
+    double mean = 0.0, var = 0.0;
+    for (const FoldScore& f : one.folds) mean += f.testRmse;
+    mean /= 12.0;
+    for (const FoldScore& f : one.folds) var += (f.testRmse - mean) * (f.testRmse - mean);
+    var /= 11.0;
+    REQUIRE(one.testRmse.mean == Approx(mean));
+    REQUIRE(one.testRmse.variance == Approx(var));
+    REQUIRE(one.testRmse.mean == Approx(0.3).epsilon(0.2));   // the noise level
+    REQUIRE(one.testMae.mean < one.testRmse.mean);
+}
+
+TEST_CASE("Cross-validation rejects bad settings", "[CrossValidation]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(10, kBeta, 0.3, 3, X, y);
+    CrossValidationOptions options;
+    options.folds = 1;
+    REQUIRE_THROWS_AS(crossValidate(X, span(y), options), std::invalid_argument);
+    options.folds = 11;
+    REQUIRE_THROWS_AS(crossValidate(X, span(y), options), std::invalid_argument);
+    options.folds = 2;
+    options.seeds.clear();
+    REQUIRE_THROWS_AS(crossValidate(X, span(y), options), std::invalid_argument);
+    REQUIRE_THROWS_AS(crossValidate(X, Span<const double>(y.data(), 9)), std::length_error);
+}
@@ -0,0 +1,105 @@
+// tests/test_dataset.cpp
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <string>
+#include "Dataset.hpp"
+
+namespace {
+
+CsvSchema machineSchema() {
+    CsvSchema s;
+    s.columns = { ColumnRole::Ignore, ColumnRole::Ignore,
+                  ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                  ColumnRole::Feature, ColumnRole::Feature, ColumnRole::Feature,
+                  ColumnRole::Target, ColumnRole::Ignore };
+    s.intercept = true;
+    return s;
+}
+
+CsvSchema twoColumns() {
+    CsvSchema s;
+    s.columns = { ColumnRole::Feature, ColumnRole::Target };
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("readCsv loads machine.data through the schema", "[Dataset]") {
+    Dataset d = readCsv("data/machine.data", machineSchema());
+    REQUIRE(d.X.rows() == 209);
+    REQUIRE(d.X.cols() == 7);
+    REQUIRE(d.y.size() == 209);
+    // adviser,32/60,125,256,6000,256,16,128,198,199
+    REQUIRE(d.X(1, 1) == 125.0);
+    REQUIRE(d.X(1, 6) == 128.0);
+    REQUIRE(d.X(1, 7) == 1.0);
+    REQUIRE(d.y[0] == 198.0);
+}
+
+TEST_CASE("parseCsv handles headers, CRLF, blanks and spaces", "[Dataset]") {
+    CsvSchema s = twoColumns();
+    s.header = true;
+    Dataset d = parseCsv("x,y\r\n1.5, 2\r\n\r\n -3e2 ,4.25\n5,6", s);
+    REQUIRE(d.X.rows() == 3);
+    REQUIRE(d.X(1, 1) == 1.5);
+    REQUIRE(d.X(2, 1) == -300.0);
+    REQUIRE(d.y[1] == 4.25);
+    REQUIRE(d.y[2] == 6.0);
+
+    CsvSchema tabs;
+    tabs.columns = { ColumnRole::Target, ColumnRole::Ignore, ColumnRole::Feature };
+    tabs.delimiter = '\t';
+    Dataset t = parseCsv("1\tname\t2\n", tabs);
+    REQUIRE(t.X(1, 1) == 2.0);
+    REQUIRE(t.y[0] == 1.0);
+}
+
+TEST_CASE("parseCsv splits large inputs across chunks in order", "[Dataset]") {
+    // Several megabytes so the input spans multiple parallel chunks.
+    std::string text;
+    const std::size_t n = 300000;
+    for (std::size_t i = 0; i < n; ++i)
+        text += std::to_string(i) + "," + std::to_string(2 * i) + "\n";
+    Dataset d = parseCsv(text, twoColumns());
+    REQUIRE(d.X.rows() == n);
+    for (std::size_t i = 0; i < n; i += 997) {
+        REQUIRE(d.X.row(i)[0] == double(i));
+        REQUIRE(d.y[i] == double(2 * i));
+    }
+    REQUIRE(d.y[n - 1] == double(2 * (n - 1)));
+}
+
+TEST_CASE("parseCsv reports malformed records with their line", "[Dataset]") {
+    CsvSchema s = twoColumns();
+    try {
+        parseCsv("1,2\n3,oops\n", s);
+        FAIL("expected a parse error");
+    } catch (const std::runtime_error& e) {
+        REQUIRE(std::string(e.what()).find("line 2") != std::string::npos);
+    }
+    REQUIRE_THROWS_AS(parseCsv("1,2,3\n", s), std::runtime_error);
+    REQUIRE_THROWS_AS(parseCsv("1\n", s), std::runtime_error);
+
+    CsvSchema noTarget;
+    noTarget.columns = { ColumnRole::Feature };
+    REQUIRE_THROWS_AS(parseCsv("1\n", noTarget), std::invalid_argument);
+    REQUIRE_THROWS_AS(readCsv("data/does-not-exist.csv", s), std::runtime_error);
+}
+
+TEST_CASE("CsvReader streams a file in chunks", "[Dataset]") {
+    Dataset all = readCsv("data/machine.data", machineSchema());
+    CsvReader reader("data/machine.data", machineSchema());
+    Matrix X(50, 7);
+    Vector y(50);
+    std::size_t total = 0, n;
+    while ((n = reader.readChunk(X, y)) > 0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            REQUIRE(y[i] == all.y[total + i]);
+            REQUIRE(X.row(i)[0] == all.X.row(total + i)[0]);
+        }
+        total += n;
+    }
+    REQUIRE(total == 209);
+    Matrix wrong(10, 3);
+    REQUIRE_THROWS_AS(reader.readChunk(wrong, y), std::length_error);
+}
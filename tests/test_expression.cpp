@@ -0,0 +1,128 @@
+// tests/test_expression.cpp
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include "Matrix.hpp"
+#include "ThreadPool.hpp"
+#include "Vector.hpp"
+
+namespace {
+
+Vector iota(std::size_t n, double start) {
+    Vector v(n);
+    for (std::size_t i = 0; i < n; ++i) v[i] = start + double(i);
+    return v;
+}
+
+Matrix iotaMatrix(std::size_t rows, std::size_t cols, double start) {
+    Matrix M(rows, cols);
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            M.row(i)[j] = start + double(i * cols + j);
+    return M;
+}
+
+} // namespace
+
+TEST_CASE("Vector expressions evaluate element-wise", "[Expression]") {
+    const Vector x = iota(5, 1.0), p = iota(5, 10.0), q = iota(5, -3.0);
+    const double alpha = 0.5;
+
+    Vector y = x + p * alpha - 2.0 * q;
+    for (std::size_t i = 0; i < 5; ++i)
+        REQUIRE(y[i] == x[i] + p[i] * alpha - 2.0 * q[i]);
+
+    Vector z = -(x - p) + +q;
+    for (std::size_t i = 0; i < 5; ++i)
+        REQUIRE(z[i] == p[i] - x[i] + q[i]);
+
+    // Unevaluated expressions index like a vector.
+    auto e = x + p;
+    REQUIRE(e.size() == 5);
+    REQUIRE(e[4] == 5.0 + 14.0);
+    REQUIRE(e(1) == 1.0 + 10.0);
+    REQUIRE_THROWS_AS(e[5], std::out_of_range);
+    REQUIRE_THROWS_AS(e(0), std::out_of_range);
+    REQUIRE(e.eval().dot(q) == Vector(x + p).dot(q));
+}
+
+TEST_CASE("Vector expressions may refer to their target", "[Expression]") {
+    Vector x = iota(4, 1.0);
+    const Vector p = iota(4, 2.0);
+    x = x + p * 0.5;
+    REQUIRE(x[3] == 4.0 + 2.5);
+    x += x * 2.0;            // x = 3x
+    REQUIRE(x[3] == 3.0 * 6.5);
+    x -= p - x;              // x = 2x - p
+    REQUIRE(x[3] == 2.0 * 19.5 - 5.0);
+
+    Vector shorter(2);
+    shorter = x + p;         // reallocates to the expression's size
+    REQUIRE(shorter.size() == 4);
+    REQUIRE(shorter[0] == x[0] + p[0]);
+}
+
+TEST_CASE("Expressions keep temporaries alive", "[Expression]") {
+    const Vector x = iota(3, 1.0);
+    auto e = x + iota(3, 100.0) * 2.0;   // the temporary is moved into e
+    Vector y = e;
+    REQUIRE(y[2] == 3.0 + 204.0);
+
+    const Matrix A = iotaMatrix(2, 2, 1.0);
+    auto m = A - iotaMatrix(2, 2, 0.0);
+    Matrix D = m;
+    REQUIRE(D(2, 2) == 1.0);
+}
+
+TEST_CASE("Mismatched shapes throw when the expression is built", "[Expression]") {
+    Vector a(3), b(4);
+    REQUIRE_THROWS_AS(a + b, std::length_error);
+    REQUIRE_THROWS_AS(a - b * 2.0, std::length_error);
+    REQUIRE_THROWS_AS(a += b * 2.0, std::length_error);
+    Matrix A(2, 3), B(3, 2);
+    REQUIRE_THROWS_AS(A + B, std::length_error);
+    REQUIRE_THROWS_AS(A - B, std::length_error);
+    REQUIRE_THROWS_AS(A += B * 2.0, std::length_error);
+}
+
+TEST_CASE("Matrix expressions evaluate element-wise", "[Expression]") {
+    const Matrix A = iotaMatrix(3, 4, 1.0), B = iotaMatrix(3, 4, -5.0);
+    Matrix C = A * 2.0 - B + 0.5 * A;
+    REQUIRE(C.rows() == 3);
+    REQUIRE(C.cols() == 4);
+    for (std::size_t i = 1; i <= 3; ++i)
+        for (std::size_t j = 1; j <= 4; ++j)
+            REQUIRE(C(i, j) == 2.5 * A(i, j) - B(i, j));
+
+    auto e = -A + B;
+    REQUIRE(e(3, 4) == -12.0 + 6.0);
+    REQUIRE_THROWS_AS(e(4, 1), std::out_of_range);
+
+    C = C - A;               // in place
+    C += A * 2.0;
+    C -= B;
+    REQUIRE(C(2, 3) == 3.5 * A(2, 3) - 2.0 * B(2, 3));
+
+    // Products stay eager and mix with element-wise expressions.
+    Matrix I(2, 2);
+    I(1, 1) = I(2, 2) = 1.0;
+    Matrix P = (I + I) * (I * 3.0);
+    REQUIRE(P(1, 1) == 6.0);
+    REQUIRE(P(1, 2) == 0.0);
+    Vector v = I * (iota(2, 1.0) + iota(2, 1.0));
+    REQUIRE(v[1] == 4.0);
+}
+
+TEST_CASE("Large matrix expressions are thread-count independent", "[Expression]") {
+    const Matrix A = iotaMatrix(300, 257, 0.25), B = iotaMatrix(300, 257, -1.0);
+    const std::size_t saved = numThreads();
+    setNumThreads(1);
+    Matrix one = A + B * 0.5;
+    setNumThreads(4);
+    Matrix four = A + B * 0.5;
+    setNumThreads(saved);
+    for (std::size_t i = 0; i < 300; ++i)
+        for (std::size_t j = 0; j < 257; ++j) {
+            REQUIRE(one.row(i)[j] == A.row(i)[j] + B.row(i)[j] * 0.5);
+            REQUIRE(four.row(i)[j] == one.row(i)[j]);
+        }
+}
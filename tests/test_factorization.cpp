@@ -0,0 +1,170 @@
+// tests/test_factorization.cpp
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <limits>
+#include "Blas.hpp"
+#include "Factorization.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+double residual(const Matrix& A, const Vector& x, const Vector& b) {
+    Vector r = A * x;
+    r -= b;
+    return std::sqrt(r.dot(r));
+}
+
+} // namespace
+
+TEST_CASE("LU solves systems larger than one block", "[LU]") {
+    const std::size_t n = 150;   // spans three panels of kBlockSize
+    Matrix A = testdata::randomMatrix(n, n, 1);
+    Vector b(n);
+    for (std::size_t i = 0; i < n; ++i) b[i] = double(i % 5) - 2.0;
+
+    LUFactorization lu(A);
+    REQUIRE(lu.size() == n);
+    Vector x = lu.solve(b);
+    REQUIRE(residual(A, x, b) < 1e-9);
+
+    Vector y(b);
+    lu.solveInPlace(y);
+    for (std::size_t i = 0; i < n; ++i)
+        REQUIRE(y[i] == Approx(x[i]));
+}
+
+TEST_CASE("LU reuses factors for a multi-column right-hand side", "[LU]") {
+    const std::size_t n = 90, m = 5;
+    Matrix A = testdata::randomMatrix(n, n, 2);
+    Matrix B = testdata::randomMatrix(n, m, 3);
+    LUFactorization lu(A);
+    Matrix X = lu.solve(B);
+    Matrix R = A * X;
+    for (std::size_t i = 1; i <= n; ++i)
+        for (std::size_t j = 1; j <= m; ++j)
+            REQUIRE(R(i,j) == Approx(B(i,j)).margin(1e-9));
+}
+
+TEST_CASE("LU pivots around zero diagonal entries", "[LU]") {
+    Matrix A(3,3);
+    A(1,2) = 1; A(2,1) = 2; A(3,3) = 4;
+    Vector b(3);
+    b[0] = 3; b[1] = 4; b[2] = 8;
+    LUFactorization lu(A);
+    REQUIRE(lu.pivots()[0] == 1);
+    Vector x = lu.solve(b);
+    REQUIRE(x[0] == Approx(2.0));
+    REQUIRE(x[1] == Approx(3.0));
+    REQUIRE(x[2] == Approx(2.0));
+}
+
+TEST_CASE("LU rejects singular and non-square input", "[LU]") {
+    Matrix S(2,2);
+    S(1,1) = 1; S(1,2) = 2; S(2,1) = 2; S(2,2) = 4;
+    REQUIRE_THROWS_AS(LUFactorization(S), std::runtime_error);
+    REQUIRE_THROWS_AS(LUFactorization(Matrix(2,3)), std::invalid_argument);
+    Matrix I(2,2);
+    I(1,1) = I(2,2) = 1;
+    REQUIRE_THROWS_AS(LUFactorization(I).solve(Vector(3)), std::invalid_argument);
+
+    // A NaN pivot compares false against the tolerance and must not slip through.
+    Matrix N(2,2);
+    N(1,1) = std::numeric_limits<double>::quiet_NaN(); N(1,2) = 1; N(2,1) = 1; N(2,2) = 1;
+    REQUIRE_THROWS_AS(LUFactorization(N), std::runtime_error);
+}
+
+TEST_CASE("Cholesky solves SPD systems across blocks", "[Cholesky]") {
+    const std::size_t n = 140;
+    Matrix X = testdata::randomMatrix(n + 10, n, 4);
+    Matrix A(n, n);
+    gemm(Transpose::Yes, Transpose::No, 1.0, X, X, 0.0, A);   // XᵀX is SPD
+    Vector b(n);
+    for (std::size_t i = 0; i < n; ++i) b[i] = 1.0 + double(i % 3);
+
+    CholeskyFactorization chol(A);
+    Vector x = chol.solve(b);
+    REQUIRE(residual(A, x, b) < 1e-8);
+
+    // L·Lᵀ reproduces A, and L is lower triangular.
+    const Matrix& L = chol.factor();
+    Matrix LLt(n, n);
+    gemm(Transpose::No, Transpose::Yes, 1.0, L, L, 0.0, LLt);
+    for (std::size_t i = 1; i <= n; i += 13)
+        for (std::size_t j = 1; j <= n; j += 7)
+            REQUIRE(LLt(i,j) == Approx(A(i,j)).margin(1e-10));
+    REQUIRE(L(1, n) == 0.0);
+
+    Matrix B(n, 2);
+    for (std::size_t i = 1; i <= n; ++i) { B(i,1) = b[i-1]; B(i,2) = -2.0 * b[i-1]; }
+    Matrix Xs = chol.solve(B);
+    REQUIRE(Xs(5,1) == Approx(x[4]));
+    REQUIRE(Xs(5,2) == Approx(-2.0 * x[4]));
+}
+
+TEST_CASE("Cholesky rejects indefinite matrices", "[Cholesky]") {
+    Matrix A(2,2);
+    A(1,1) = 1; A(1,2) = 2; A(2,1) = 2; A(2,2) = 1;
+    REQUIRE_THROWS_AS(CholeskyFactorization(A), std::runtime_error);
+}
+
+TEST_CASE("QR least squares matches an exact fit", "[QR]") {
+    // y = 1.5 x1 - 2 x2 + 0.5 on 40 points.
+    const std::size_t m = 40;
+    Matrix X(m, 3);
+    Vector y(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        double x1 = std::sin(double(i)), x2 = std::cos(0.3 * double(i));
+        X.row(i)[0] = x1; X.row(i)[1] = x2; X.row(i)[2] = 1.0;
+        y[i] = 1.5 * x1 - 2.0 * x2 + 0.5;
+    }
+    QRFactorization qr(X);
+    Vector beta = qr.solve(y);
+    REQUIRE(beta[0] == Approx(1.5));
+    REQUIRE(beta[1] == Approx(-2.0));
+    REQUIRE(beta[2] == Approx(0.5));
+
+    // RᵀR equals XᵀX.
+    Matrix R = qr.R();
+    Matrix RtR(3,3), XtX(3,3);
+    gemm(Transpose::Yes, Transpose::No, 1.0, R, R, 0.0, RtR);
+    gemm(Transpose::Yes, Transpose::No, 1.0, X, X, 0.0, XtX);
+    for (std::size_t i = 1; i <= 3; ++i)
+        for (std::size_t j = 1; j <= 3; ++j)
+            REQUIRE(RtR(i,j) == Approx(XtX(i,j)));
+
+    Matrix dup(5, 2);
+    for (std::size_t i = 1; i <= 5; ++i) dup(i,1) = dup(i,2) = double(i);
+    REQUIRE_THROWS_AS(QRFactorization(dup), std::runtime_error);
+    REQUIRE_THROWS_AS(QRFactorization(Matrix(2,3)), std::invalid_argument);
+}
+
+TEST_CASE("SVD reconstructs the matrix with ordered singular values", "[SVD]") {
+    Matrix A = testdata::randomMatrix(30, 8, 5);
+    SVDFactorization svd(A);
+    const Vector& s = svd.singularValues();
+    REQUIRE(s.size() == 8);
+    for (std::size_t k = 1; k < s.size(); ++k)
+        REQUIRE(s[k-1] >= s[k]);
+    REQUIRE(svd.rank() == 8);
+
+    Matrix US = svd.U();
+    for (std::size_t i = 0; i < US.rows(); ++i)
+        for (std::size_t k = 0; k < 8; ++k)
+            US.row(i)[k] *= s[k];
+    Matrix R(30, 8);
+    gemm(Transpose::No, Transpose::Yes, 1.0, US, svd.V(), 0.0, R);
+    for (std::size_t i = 1; i <= 30; ++i)
+        for (std::size_t j = 1; j <= 8; ++j)
+            REQUIRE(R(i,j) == Approx(A(i,j)).margin(1e-12));
+
+}
+
+TEST_CASE("LU determinant and inverse reuse the factors", "[LU]") {
+    Matrix A = testdata::randomMatrix(70, 70, 6);
+    LUFactorization lu(A);
+    Matrix Ainv = lu.inverse();
+    REQUIRE(lu.determinant() * LUFactorization(Ainv).determinant() == Approx(1.0));
+    Matrix I = A * Ainv;
+    for (std::size_t i = 1; i <= 70; ++i)
+        REQUIRE(I(i,i) == Approx(1.0));
+}
@@ -0,0 +1,116 @@
+// tests/test_fixed_matrix.cpp
+#include <catch2/catch.hpp>
+#include <random>
+#include <stdexcept>
+#include "Factorization.hpp"
+#include "FixedMatrix.hpp"
+
+namespace {
+
+template <std::size_t N>
+FixedMatrix<N, N> randomSpd(unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    FixedMatrix<N, N> B;
+    for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            B.row(i)[j] = dist(rng);
+    return B.transpose() * B + FixedMatrix<N, N>::identity() * double(N);
+}
+
+} // namespace
+
+// Dimensions and simple arithmetic are usable in constant expressions.
+static_assert(FixedMatrix<3, 5>::rows() == 3 && FixedMatrix<3, 5>::cols() == 5, "");
+static_assert(FixedVector<7>::size() == 7, "");
+static_assert((FixedMatrix<2, 2>::identity() * 3.0)(2, 2) == 3.0, "");
+static_assert((FixedMatrix<2, 3>::identity() * FixedMatrix<3, 2>::identity())(1, 1) == 1.0, "");
+
+TEST_CASE("Fixed-size arithmetic", "[FixedMatrix]") {
+    FixedMatrix<2, 3> A;
+    A(1, 1) = 1; A(1, 2) = 2; A(1, 3) = 3;
+    A(2, 1) = 4; A(2, 2) = 5; A(2, 3) = 6;
+    FixedVector<3> x;
+    x[0] = 1; x[1] = 0; x[2] = -1;
+
+    const FixedVector<2> y = A * x;
+    REQUIRE(y[0] == -2.0);
+    REQUIRE(y[1] == -2.0);
+
+    const FixedMatrix<2, 2> AAt = A * A.transpose();
+    REQUIRE(AAt(1, 1) == 14.0);
+    REQUIRE(AAt(1, 2) == 32.0);
+    REQUIRE(AAt(2, 2) == 77.0);
+
+    const FixedMatrix<2, 3> B = 2.0 * A - A * 0.5 + A;
+    REQUIRE(B(2, 3) == 15.0);
+    REQUIRE((x + x * 2.0 - x)[2] == -2.0);
+    REQUIRE(x.dot(x) == 2.0);
+
+    REQUIRE_THROWS_AS(A(3, 1), std::out_of_range);
+    REQUIRE_THROWS_AS(A(1, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(x[3], std::out_of_range);
+}
+
+TEST_CASE("Fixed-size types convert to and from Matrix/Vector", "[FixedMatrix]") {
+    Matrix M(3, 2);
+    M(1, 1) = 1; M(2, 2) = 2; M(3, 1) = 3;
+    const FixedMatrix<3, 2> F(M);
+    REQUIRE(F(3, 1) == 3.0);
+    const Matrix back = F.toMatrix();
+    for (std::size_t i = 1; i <= 3; ++i)
+        for (std::size_t j = 1; j <= 2; ++j)
+            REQUIRE(back(i, j) == M(i, j));
+    REQUIRE(F.view()(2, 2) == 2.0);
+
+    Vector v(4);
+    v[3] = 7.0;
+    const FixedVector<4> fv(v);
+    REQUIRE(fv[3] == 7.0);
+    REQUIRE(fv.toVector()[3] == 7.0);
+
+    REQUIRE_THROWS_AS((FixedMatrix<2, 2>(M)), std::length_error);
+    REQUIRE_THROWS_AS(FixedVector<3>(v), std::length_error);
+}
+
+TEST_CASE("Fixed-size LU matches LUFactorization", "[FixedMatrix]") {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    FixedMatrix<7, 7> A;
+    FixedVector<7> b;
+    for (std::size_t i = 0; i < 7; ++i) {
+        for (std::size_t j = 0; j < 7; ++j)
+            A.row(i)[j] = dist(rng);
+        b[i] = dist(rng);
+    }
+    const FixedLUFactorization<7> lu(A);
+    const FixedVector<7> x = lu.solve(b);
+    const LUFactorization reference(A.toMatrix());
+    const Vector xr = reference.solve(b.toVector());
+    for (std::size_t i = 0; i < 7; ++i)
+        REQUIRE(x[i] == Approx(xr[i]).margin(1e-12));
+    REQUIRE(lu.determinant() == Approx(reference.determinant()));
+
+    FixedMatrix<3, 3> singular;
+    singular(1, 1) = 1; singular(2, 1) = 2;
+    REQUIRE_THROWS_AS(FixedLUFactorization<3>(singular), std::runtime_error);
+}
+
+TEST_CASE("Fixed-size Cholesky matches CholeskyFactorization", "[FixedMatrix]") {
+    const FixedMatrix<7, 7> A = randomSpd<7>(6);
+    FixedVector<7> b;
+    for (std::size_t i = 0; i < 7; ++i) b[i] = double(i) - 3.0;
+
+    const FixedCholeskyFactorization<7> chol(A);
+    const FixedVector<7> x = chol.solve(b);
+    const Vector xr = CholeskyFactorization(A.toMatrix()).solve(b.toVector());
+    for (std::size_t i = 0; i < 7; ++i)
+        REQUIRE(x[i] == Approx(xr[i]).margin(1e-12));
+    const FixedVector<7> r = A * x - b;
+    REQUIRE(r.dot(r) < 1e-20);
+    REQUIRE(chol.factor()(1, 2) == 0.0);
+
+    FixedMatrix<2, 2> indefinite = FixedMatrix<2, 2>::identity();
+    indefinite(2, 2) = -1.0;
+    REQUIRE_THROWS_AS(FixedCholeskyFactorization<2>(indefinite), std::runtime_error);
+}
@@ -0,0 +1,118 @@
+// tests/test_linear_model.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "LinearModel.hpp"
+#include "TestData.hpp"
+#include "ThreadPool.hpp"
+
+namespace {
+
+Vector vectorOf(std::initializer_list<double> values) {
+    Vector v(values.size());
+    std::size_t i = 0;
+    for (double x : values) v[i++] = x;
+    return v;
+}
+
+} // namespace
+
+TEST_CASE("LinearModel predicts single rows and batches identically", "[LinearModel]") {
+    std::mt19937 rng(17);
+    const std::size_t p = 9;
+    const Matrix B = testdata::randomMatrix(1, p, rng);
+    Vector beta(p);
+    std::copy(B.row(0), B.row(0) + p, beta.data());
+    const LinearModel model(beta, 0.5);
+    REQUIRE(model.features() == p);
+
+    // Odd row count exercises the four-row kernel and its tail.
+    const Matrix X = testdata::randomMatrix(103, p, rng);
+    const Vector batch = model.predict(X);
+    REQUIRE(batch.size() == 103);
+    for (std::size_t i = 0; i < X.rows(); ++i) {
+        double expected = 0.5;
+        for (std::size_t j = 0; j < p; ++j)
+            expected += X.row(i)[j] * beta[j];
+        REQUIRE(batch[i] == Approx(expected).margin(1e-14));
+        REQUIRE(model.predict(X.rowView(i)) == batch[i]);
+        REQUIRE(model.predict(X.row(i)) == batch[i]);
+    }
+
+    Vector wrong(3);
+    REQUIRE_THROWS_AS(model.predict(Span<const double>(wrong.data(), wrong.size())),
+                      std::length_error);
+    REQUIRE_THROWS_AS(model.predict(Matrix(4, p + 1)), std::length_error);
+    Vector out(5);
+    REQUIRE_THROWS_AS(model.predict(X, Span<double>(out.data(), out.size())), std::length_error);
+}
+
+TEST_CASE("LinearModel folds feature standardization into its weights", "[LinearModel]") {
+    // Fitted on z = (x - mean) / scale: ŷ = 1 + 2 z1 - 3 z2.
+    const LinearModel model(vectorOf({2.0, -3.0}), 1.0,
+                            vectorOf({10.0, -1.0}), vectorOf({4.0, 0.5}));
+    REQUIRE(model.weights()[0] == Approx(0.5));
+    REQUIRE(model.weights()[1] == Approx(-6.0));
+    const double x[2] = {14.0, 0.0};   // z = (1, 2)
+    REQUIRE(model.predict(x) == Approx(1.0 + 2.0 - 6.0));
+
+    REQUIRE_THROWS_AS(LinearModel(vectorOf({1.0}), 0.0, vectorOf({0.0}), vectorOf({0.0})),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(LinearModel(vectorOf({1.0, 2.0}), 0.0, vectorOf({0.0}), vectorOf({1.0})),
+                      std::length_error);
+}
+
+TEST_CASE("LinearModel metrics match a two-pass reference", "[LinearModel]") {
+    std::mt19937 rng(23);
+    std::normal_distribution<double> noise(0.0, 0.1);
+    const std::size_t m = 20000, p = 6;   // several parallel blocks
+    const Matrix X = testdata::randomMatrix(m, p, rng);
+    const Vector beta = vectorOf({1.0, -2.0, 0.5, 3.0, 0.0, -1.5});
+    const LinearModel model(beta, 100.0);
+    Vector y = model.predict(X);
+    for (double& v : y) v += noise(rng);
+
+    double sse = 0.0, sae = 0.0, mean = 0.0;
+    const Vector pred = model.predict(X);
+    for (std::size_t i = 0; i < m; ++i) {
+        sse  += (pred[i] - y[i]) * (pred[i] - y[i]);
+        sae  += std::abs(pred[i] - y[i]);
+        mean += y[i];
+    }
+    mean /= double(m);
+    double sst = 0.0;
+    for (double v : y) sst += (v - mean) * (v - mean);
+
+    const RegressionMetrics metrics = model.evaluate(X, y);
+    REQUIRE(metrics.count == m);
+    REQUIRE(metrics.rmse == Approx(std::sqrt(sse / double(m))).epsilon(1e-12));
+    REQUIRE(metrics.mae == Approx(sae / double(m)).epsilon(1e-12));
+    REQUIRE(metrics.r2 == Approx(1.0 - sse / sst).epsilon(1e-12));
+    REQUIRE(metrics.r2 > 0.99);
+
+    // Fixed blocks: identical bits whatever the thread count.
+    const std::size_t threads = numThreads();
+    setNumThreads(1);
+    const RegressionMetrics serial = model.evaluate(X, y);
+    setNumThreads(4);
+    const RegressionMetrics parallel = model.evaluate(X, y);
+    setNumThreads(threads);
+    REQUIRE(serial.rmse == parallel.rmse);
+    REQUIRE(serial.r2 == parallel.r2);
+}
+
+TEST_CASE("LinearModel metrics handle constant targets and bad input", "[LinearModel]") {
+    const LinearModel model(vectorOf({0.0}), 3.0);
+    Matrix X(4, 1);
+    Vector y(4);
+    for (double& v : y) v = 3.0;
+    RegressionMetrics exact = model.evaluate(X, y);
+    REQUIRE(exact.rmse == 0.0);
+    REQUIRE(exact.r2 == 1.0);
+    y[0] = 5.0;
+    REQUIRE(model.evaluate(X, y).mae == Approx(0.5));
+
+    REQUIRE_THROWS_AS(model.evaluate(Matrix(0, 1), Vector(0)), std::invalid_argument);
+    REQUIRE_THROWS_AS(model.evaluate(X, Vector(3)), std::length_error);
+}
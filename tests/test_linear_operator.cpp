@@ -0,0 +1,127 @@
+// tests/test_linear_operator.cpp
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <vector>
+#include "ConjugateGradient.hpp"
+#include "Factorization.hpp"
+#include "LinearOperator.hpp"
+#include "LinearSystem.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// Only knows how to apply itself: 2·x.
+class Doubling : public LinearOperator {
+public:
+    explicit Doubling(std::size_t n) : mN(n) {}
+    std::size_t rows() const noexcept override { return mN; }
+    std::size_t cols() const noexcept override { return mN; }
+    void apply(const Vector& x, Vector& y) const override {
+        for (std::size_t i = 0; i < mN; ++i) y[i] = 2.0 * x[i];
+    }
+private:
+    std::size_t mN;
+};
+
+} // namespace
+
+TEST_CASE("Matrix transposeMultiply matches the explicit transpose", "[Operator]") {
+    // Tall enough to span several row blocks of the parallel reduction.
+    const std::size_t m = 40000, n = 5;
+    Matrix X = testdata::randomMatrix(m, n, 3);
+    Vector r = testdata::randomVector(m, 4);
+    Vector y(n);
+    X.transposeMultiply(r, y);
+    for (std::size_t j = 0; j < n; ++j) {
+        double expected = 0.0;
+        for (std::size_t i = 0; i < m; ++i) expected += X.row(i)[j] * r[i];
+        REQUIRE(y[j] == Approx(expected).epsilon(1e-10));
+    }
+    Vector wrong(n + 1);
+    REQUIRE_THROWS_AS(X.transposeMultiply(r, wrong), std::length_error);
+}
+
+TEST_CASE("Matrix transposeMultiply reuses a caller-owned scratch buffer", "[Operator]") {
+    const std::size_t m = 40000, n = 5;
+    Matrix X = testdata::randomMatrix(m, n, 5);
+    Vector r = testdata::randomVector(m, 6);
+    Vector expected(n), y(n);
+    X.transposeMultiply(r, expected);
+
+    std::vector<double> scratch;
+    X.transposeMultiply(r, y, scratch);
+    REQUIRE_FALSE(scratch.empty());
+    const double* buffer = scratch.data();
+    for (int pass = 0; pass < 3; ++pass) {
+        X.transposeMultiply(r, y, scratch);
+        REQUIRE(scratch.data() == buffer);
+        for (std::size_t j = 0; j < n; ++j) REQUIRE(y[j] == expected[j]);
+    }
+
+    DenseOperator op(X);
+    Vector z(n);
+    op.applyTranspose(r, z);
+    op.applyTranspose(r, z);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(z[j] == expected[j]);
+}
+
+TEST_CASE("DenseOperator forwards to the matrix", "[Operator]") {
+    Matrix A = testdata::randomMatrix(6, 4, 1);
+    DenseOperator op(A);
+    REQUIRE(op.rows() == 6);
+    REQUIRE(op.cols() == 4);
+    Vector x = testdata::randomVector(4, 2);
+    Vector y(6);
+    op.apply(x, y);
+    Vector expected = A * x;
+    for (std::size_t i = 0; i < 6; ++i)
+        REQUIRE(y[i] == Approx(expected[i]));
+}
+
+TEST_CASE("Operators without a transpose say so", "[Operator]") {
+    Doubling op(3);
+    Vector x(3), y(3);
+    REQUIRE_THROWS_AS(op.applyTranspose(x, y), std::logic_error);
+}
+
+TEST_CASE("CG runs on a user-defined operator", "[Operator]") {
+    Doubling op(4);
+    Vector b = testdata::randomVector(4, 5);
+    Vector x = PosSymLinSystem(op, b).Solve();
+    for (std::size_t i = 0; i < 4; ++i)
+        REQUIRE(x[i] == Approx(0.5 * b[i]));
+}
+
+TEST_CASE("NormalOperator solves least squares without forming XᵀX", "[Operator]") {
+    const std::size_t m = 300, n = 8;
+    Matrix X = testdata::randomMatrix(m, n, 11);
+    Vector y = testdata::randomVector(m, 12);
+    Vector expected = QRFactorization(X).solve(y);
+
+    DenseOperator Xop(X);
+    NormalOperator normal(Xop);
+    REQUIRE(normal.rows() == n);
+    REQUIRE(normal.cols() == n);
+    CGOptions opts;
+    opts.relTol = 1e-12;
+    Vector x = PosSymLinSystem(normal, normal.rhs(y), opts).Solve();
+    for (std::size_t j = 0; j < n; ++j)
+        REQUIRE(x[j] == Approx(expected[j]).epsilon(1e-8));
+}
+
+TEST_CASE("NormalOperator adds the ridge term", "[Operator]") {
+    Matrix X = testdata::randomMatrix(20, 3, 21);
+    DenseOperator Xop(X);
+    NormalOperator ridge(Xop, 0.5);
+    Vector p = testdata::randomVector(3, 22);
+    Vector y(3);
+    ridge.apply(p, y);
+
+    Vector Xp = X * p;
+    Vector expected(3);
+    X.transposeMultiply(Xp, expected);
+    expected.axpy(0.5, p);
+    for (std::size_t j = 0; j < 3; ++j)
+        REQUIRE(y[j] == Approx(expected[j]));
+    REQUIRE_THROWS_AS(NormalOperator(Xop, -1.0), std::invalid_argument);
+}
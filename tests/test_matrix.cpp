@@ -1,6 +1,8 @@
 // tests/test_matrix.cpp
 #include <catch2/catch.hpp>
+#include "Factorization.hpp"
 #include "Matrix.hpp"
+#include <cstdint>
 
 TEST_CASE("Matrix construction and element access", "[Matrix]") {
     Matrix m(2,3);
@@ -62,3 +64,158 @@ TEST_CASE("Matrix assignment reallocates for size change", "[Matrix]") {
     for (std::size_t i=1;i<=3;++i)
         REQUIRE(A(i,1) == Approx(B(i,1)));
 }
+
+TEST_CASE("Matrix storage is contiguous row-major", "[Matrix]") {
+    Matrix A(3,4);
+    REQUIRE(A.stride() >= A.cols());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(A.data()) % Matrix::kAlignment == 0);
+    for (std::size_t i=1;i<=3;++i)
+        for (std::size_t j=1;j<=4;++j)
+            A(i,j) = 10.0*i + j;
+    REQUIRE(A.row(0) == A.data());
+    REQUIRE(A.row(2) == A.data() + 2*A.stride());
+    REQUIRE(A.row(1)[2] == Approx(A(2,3)));
+
+    Matrix B(A);
+    REQUIRE(B.data() != A.data());
+    REQUIRE(B.row(2)[3] == Approx(34.0));
+}
+
+TEST_CASE("Matrix move, compound and output-parameter products", "[Matrix]") {
+    Matrix A(2,2), B(2,2);
+    A(1,1)=1; A(1,2)=2; A(2,1)=3; A(2,2)=4;
+    B(1,1)=5; B(1,2)=6; B(2,1)=7; B(2,2)=8;
+
+    Matrix C(2,2);
+    C(1,1) = 99;  // overwritten, not accumulated
+    A.multiply(B, C);
+    REQUIRE( C(1,1) == 19 ); REQUIRE( C(2,2) == 50 );
+    REQUIRE_THROWS_AS( A.multiply(B, A), std::invalid_argument );
+    Matrix wrong(3,2);
+    REQUIRE_THROWS_AS( A.multiply(B, wrong), std::length_error );
+
+    Vector x(2), y(2);
+    x[0] = 1; x[1] = -1;
+    A.multiply(x, y);
+    REQUIRE( y[0] == Approx(-1.0) ); REQUIRE( y[1] == Approx(-1.0) );
+    REQUIRE( (A * x)[1] == Approx(-1.0) );
+
+    A += B;
+    REQUIRE( A(1,1) == 6 );
+    A -= B;
+    A *= 3.0;
+    REQUIRE( A(2,2) == 12 );
+
+    Matrix M(std::move(A));
+    REQUIRE( M.rows() == 2 );
+    REQUIRE( A.rows() == 0 );
+    A = std::move(M);
+    REQUIRE( A(1,2) == 6 );
+}
+
+TEST_CASE("Matrix row/column views and iterators", "[Matrix]") {
+    Matrix A(3,2);
+    A(1,1)=1; A(1,2)=2; A(2,1)=3; A(2,2)=4; A(3,1)=5; A(3,2)=6;
+
+    auto r = A.rowView(1);
+    REQUIRE(r.size() == 2);
+    REQUIRE(r[0] == 3); REQUIRE(r[1] == 4);
+
+    auto c = A.colView(1);
+    REQUIRE(c.size() == 3);
+    double colSum = 0.0;
+    for (double v : c) colSum += v;
+    REQUIRE(colSum == Approx(12.0));
+    REQUIRE(c.end() - c.begin() == 3);
+
+    c[2] = 60;
+    REQUIRE(A(3,2) == 60);
+
+    double total = 0.0;
+    for (double v : A) total += v;
+    REQUIRE(total == Approx(1+2+3+4+5+60));
+    REQUIRE(A.end() - A.begin() == 6);
+}
+
+TEST_CASE("Determinant and inverse", "[Matrix]") {
+    Matrix A(3,3);
+    A(1,1)=2; A(1,2)=0; A(1,3)=1;
+    A(2,1)=1; A(2,2)=3; A(2,3)=2;
+    A(3,1)=1; A(3,2)=1; A(3,3)=2;
+    REQUIRE( A.determinant() == Approx(6.0) );
+
+    Matrix Ainv = A.inverse();
+    Matrix I = A * Ainv;
+    for (std::size_t i=1;i<=3;++i)
+        for (std::size_t j=1;j<=3;++j)
+            REQUIRE( I(i,j) == Approx(i==j ? 1.0 : 0.0).margin(1e-12) );
+
+    // Row swap flips the sign.
+    Matrix P(2,2);
+    P(1,2)=1; P(2,1)=1;
+    REQUIRE( P.determinant() == Approx(-1.0) );
+
+    Matrix S(2,2);
+    S(1,1)=1; S(1,2)=2; S(2,1)=2; S(2,2)=4;
+    REQUIRE( S.determinant() == 0.0 );
+    REQUIRE_THROWS_AS( S.inverse(), std::runtime_error );
+    REQUIRE_THROWS_AS( Matrix(2,3).determinant(), std::invalid_argument );
+    REQUIRE_THROWS_AS( Matrix(2,3).inverse(), std::invalid_argument );
+}
+
+TEST_CASE("Determinant and inverse of badly scaled nonsingular matrices", "[Matrix]") {
+    // Tiny pivots are fine as long as they are not tiny for their column.
+    Matrix D(2,2);
+    D(1,1)=1e-13; D(2,2)=1e13;
+    REQUIRE( D.determinant() == Approx(1.0) );
+    Matrix Dinv = D.inverse();
+    REQUIRE( Dinv(1,1) == Approx(1e13) );
+    REQUIRE( Dinv(2,2) == Approx(1e-13) );
+    REQUIRE( Dinv(1,2) == 0.0 );
+    REQUIRE( LUFactorization(D).determinant() == Approx(1.0) );
+
+    Matrix T(3,3);
+    T(1,1)=1e-20; T(1,2)=2e-20; T(1,3)=0;
+    T(2,1)=3e-20; T(2,2)=4e-20; T(2,3)=0;
+    T(3,1)=0;     T(3,2)=0;     T(3,3)=5;
+    REQUIRE( T.determinant() == Approx(-1e-39) );
+    Matrix Tinv = T.inverse();
+    REQUIRE( Tinv(1,1) == Approx(-2e20) );
+    REQUIRE( Tinv(1,2) == Approx(1e20) );
+    REQUIRE( Tinv(2,1) == Approx(1.5e20) );
+    REQUIRE( Tinv(2,2) == Approx(-0.5e20) );
+    REQUIRE( Tinv(3,3) == Approx(0.2) );
+
+    // An exactly zero column is still singular.
+    Matrix Z(2,2);
+    Z(1,2)=1e-30; Z(2,2)=1e30;
+    REQUIRE( Z.determinant() == 0.0 );
+    REQUIRE_THROWS_AS( Z.inverse(), std::runtime_error );
+}
+
+TEST_CASE("Pseudo-inverse of rank-deficient and rectangular matrices", "[Matrix]") {
+    // Rank-1 3×2 matrix: columns are multiples of (1,2,2).
+    Matrix A(3,2);
+    A(1,1)=1; A(2,1)=2; A(3,1)=2;
+    A(1,2)=2; A(2,2)=4; A(3,2)=4;
+    Matrix P = A.pseudoInverse();
+    REQUIRE( P.rows() == 2 );
+    REQUIRE( P.cols() == 3 );
+    // A⁺ = Aᵀ / (||a||² ||c||²) with a=(1,2,2), c=(1,2): 9 * 5 = 45.
+    for (std::size_t i=1;i<=2;++i)
+        for (std::size_t j=1;j<=3;++j)
+            REQUIRE( P(i,j) == Approx(A(j,i) / 45.0).margin(1e-12) );
+
+    // Penrose conditions A A⁺ A = A for a wide full-rank matrix.
+    Matrix W(2,3);
+    W(1,1)=1; W(1,2)=2; W(1,3)=3;
+    W(2,1)=4; W(2,2)=5; W(2,3)=7;
+    Matrix R = W * W.pseudoInverse() * W;
+    for (std::size_t i=1;i<=2;++i)
+        for (std::size_t j=1;j<=3;++j)
+            REQUIRE( R(i,j) == Approx(W(i,j)) );
+
+    // A huge tolerance drops everything.
+    Matrix Z = W.pseudoInverse(1e6);
+    for (double v : Z) REQUIRE( v == 0.0 );
+}
@@ -0,0 +1,238 @@
+// tests/test_memory_resource.cpp
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include "BasicMatrix.hpp"
+#include "Factorization.hpp"
+#include "LinearSystem.hpp"
+#include "Matrix.hpp"
+#include "MemoryResource.hpp"
+
+namespace {
+
+// Forwards to new/delete and counts the traffic.
+class CountingResource : public MemoryResource {
+public:
+    std::size_t allocations = 0, deallocations = 0, bytesLive = 0;
+
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        bytesLive += bytes;
+        return newDeleteResource()->allocate(bytes, alignment);
+    }
+    void doDeallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept override {
+        ++deallocations;
+        bytesLive -= bytes;
+        newDeleteResource()->deallocate(p, bytes, alignment);
+    }
+};
+
+bool aligned(const void* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+} // namespace
+
+TEST_CASE("Containers allocate from the thread's current resource", "[MemoryResource]") {
+    REQUIRE(currentResource() == newDeleteResource());
+    CountingResource counting;
+    {
+        ScopedResource scope(counting);
+        REQUIRE(currentResource() == &counting);
+        Matrix A(3, 4);
+        Vector v(5);
+        FloatMatrix F(2, 2);
+        REQUIRE(A.resource() == &counting);
+        REQUIRE(v.resource() == &counting);
+        REQUIRE(counting.allocations == 3);
+        REQUIRE(counting.bytesLive == (12 + 5) * sizeof(double) + 4 * sizeof(float));
+        REQUIRE(aligned(A.data(), Matrix::kAlignment));
+        REQUIRE(aligned(v.data(), MemoryResource::kDefaultAlignment));
+
+        // Other threads keep their own current resource.
+        MemoryResource* seen = nullptr;
+        std::thread([&] { seen = currentResource(); }).join();
+        REQUIRE(seen == newDeleteResource());
+    }
+    REQUIRE(currentResource() == newDeleteResource());
+    REQUIRE(counting.deallocations == 3);
+    REQUIRE(counting.bytesLive == 0);
+}
+
+TEST_CASE("Copies, moves and assignment keep track of the owning resource", "[MemoryResource]") {
+    CountingResource counting;
+    Vector outside(2);
+    Matrix kept(1, 1);
+    {
+        ScopedResource scope(counting);
+        Vector inside(3);
+        inside[2] = 7.0;
+        Vector moved(std::move(inside));
+        REQUIRE(moved.resource() == &counting);
+
+        // Copy assignment reallocates from the destination's resource.
+        outside = moved;
+        REQUIRE(outside.resource() == newDeleteResource());
+        REQUIRE(outside[2] == 7.0);
+
+        Matrix M(2, 3);
+        M(2, 3) = 4.0;
+        kept = M;
+        REQUIRE(kept.resource() == newDeleteResource());
+        REQUIRE(kept(2, 3) == 4.0);
+
+        // Move assignment across resources copies instead of stealing...
+        Vector other(4);
+        other[3] = 5.0;
+        outside = std::move(other);
+        REQUIRE(outside.resource() == newDeleteResource());
+        REQUIRE(outside[3] == 5.0);
+        Matrix N(3, 2);
+        N(3, 2) = 6.0;
+        kept = std::move(N);
+        REQUIRE(kept.resource() == newDeleteResource());
+        REQUIRE(kept(3, 2) == 6.0);
+        FloatVector f(2);
+        {
+            ScopedResource defaults(*newDeleteResource());
+            FloatVector g(3);
+            g[2] = 1.5f;
+            f = std::move(g);
+        }
+        REQUIRE(f.size() == 3);
+        REQUIRE(f[2] == 1.5f);
+
+        // ...and steals the buffer when both sides share one.
+        Vector same(4);
+        const double* buffer = same.data();
+        moved = std::move(same);
+        REQUIRE(moved.data() == buffer);
+        REQUIRE(moved.resource() == &counting);
+    }
+    REQUIRE(counting.bytesLive == 0);
+    // A copy made outside the scope uses the default resource again.
+    Vector copy(outside);
+    REQUIRE(copy.resource() == newDeleteResource());
+}
+
+TEST_CASE("Arena hands out aligned memory and rewinds on reset", "[MemoryResource]") {
+    CountingResource upstream;
+    ArenaResource arena(1024, &upstream);
+    void* a = arena.allocate(100);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(64, 256);
+    REQUIRE(aligned(a, 64));
+    REQUIRE(aligned(b, 8));
+    REQUIRE(aligned(c, 256));
+    REQUIRE(upstream.allocations == 1);
+    arena.deallocate(a, 100);   // no-op
+    REQUIRE(arena.bytesUsed() >= 172);
+
+    void* big = arena.allocate(5000);   // its own block
+    REQUIRE(big != nullptr);
+    REQUIRE(upstream.allocations == 2);
+    REQUIRE(arena.capacity() >= 1024 + 5000);
+
+    arena.reset();
+    REQUIRE(arena.bytesUsed() == 0);
+    REQUIRE(arena.allocate(100) == a);
+    arena.allocate(5000);
+    REQUIRE(upstream.allocations == 2);   // served from the kept blocks
+
+    arena.release();
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(upstream.bytesLive == 0);
+}
+
+TEST_CASE("ScopedArena frees every temporary at once and reuses its blocks", "[MemoryResource]") {
+    CountingResource upstream;
+    ArenaResource arena(ArenaResource::kDefaultBlockBytes, &upstream);
+    Matrix A(6, 6);
+    for (std::size_t i = 1; i <= 6; ++i)
+        for (std::size_t j = 1; j <= 6; ++j)
+            A(i, j) = i == j ? 10.0 : 1.0 / double(i + j);
+    Vector b(6);
+    b[0] = 1.0;
+    Vector x(6);
+
+    std::size_t firstRound = 0;
+    for (int round = 0; round < 3; ++round) {
+        {
+            ScopedArena scope(arena);
+            REQUIRE(currentResource() == &arena);
+            Vector y = CholeskySystem(A, b).Solve();
+            REQUIRE(y.resource() == &arena);
+            x = y;
+            REQUIRE(arena.bytesUsed() > 0);
+        }
+        REQUIRE(currentResource() == newDeleteResource());
+        REQUIRE(arena.bytesUsed() == 0);
+        if (round == 0)
+            firstRound = upstream.allocations;
+    }
+    REQUIRE(firstRound >= 1);
+    REQUIRE(upstream.allocations == firstRound);   // later rounds never hit upstream
+    REQUIRE(x.resource() == newDeleteResource());
+    Vector r = A * x - b;
+    REQUIRE(r.dot(r) < 1e-24);
+
+    {
+        ScopedArena owned(256);
+        Matrix T(4, 4);
+        REQUIRE(T.resource() == &owned.arena());
+    }
+}
+
+TEST_CASE("Results can be move-assigned out of an arena scope", "[MemoryResource]") {
+    Matrix A(5, 5);
+    for (std::size_t i = 1; i <= 5; ++i)
+        for (std::size_t j = 1; j <= 5; ++j)
+            A(i, j) = i == j ? 8.0 : 1.0 / double(i + j);
+    Vector b(5);
+    b[4] = 2.0;
+    Vector x(5);
+    Matrix I(1, 1);
+    {
+        ScopedArena scope;
+        x = CholeskySystem(A, b).Solve();
+        I = CholeskyFactorization(A).solve(A);
+    }
+    // The arena is gone; the results live in the destinations' resource.
+    REQUIRE(x.resource() == newDeleteResource());
+    REQUIRE(I.resource() == newDeleteResource());
+    Vector r = A * x - b;
+    REQUIRE(r.dot(r) < 1e-24);
+    REQUIRE(I(5, 5) == Approx(1.0));
+    REQUIRE(I(1, 5) == Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("Pool caches freed buffers by size class", "[MemoryResource]") {
+    CountingResource upstream;
+    {
+        PoolResource pool(&upstream);
+        {
+            ScopedResource scope(pool);
+            for (int i = 0; i < 10; ++i) {
+                Vector v(100);   // 800 bytes: the 1 KiB class
+                Matrix M(10, 9); // 720 bytes: same class, live at the same time
+                REQUIRE(v[99] == 0.0);
+                REQUIRE(M(10, 9) == 0.0);
+            }
+        }
+        REQUIRE(upstream.allocations == 2);
+        REQUIRE(pool.cachedBuffers() == 2);
+
+        // Oversized requests bypass the pool.
+        void* p = pool.allocate(PoolResource::kMaxPooledBytes + 1);
+        REQUIRE(upstream.allocations == 3);
+        pool.deallocate(p, PoolResource::kMaxPooledBytes + 1);
+        REQUIRE(pool.cachedBuffers() == 2);
+
+        pool.release();
+        REQUIRE(pool.cachedBuffers() == 0);
+        REQUIRE(upstream.bytesLive == 0);
+    }
+    REQUIRE(upstream.deallocations == upstream.allocations);
+}
@@ -0,0 +1,149 @@
+// tests/test_mixed_precision.cpp
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include "BasicMatrix.hpp"
+#include "Factorization.hpp"
+#include "LinearSystem.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// Diagonally dominant, so well conditioned, with pivoting still exercised.
+Matrix wellConditioned(std::size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix A(n, n);
+    for (double& v : A) v = dist(rng);
+    for (std::size_t i = 0; i < n; ++i)
+        A.row(i)[i] += static_cast<double>(n) / 4.0;
+    return A;
+}
+
+} // namespace
+
+TEST_CASE("BasicMatrix and BasicVector convert to and from double", "[BasicMatrix]") {
+    Matrix A(2, 3);
+    A(1, 1) = 1.5; A(2, 3) = -0.25;
+    FloatMatrix F(A);
+    REQUIRE(F.rows() == 2);
+    REQUIRE(F.cols() == 3);
+    REQUIRE(F(1, 1) == 1.5f);
+    REQUIRE(F(2, 3) == -0.25f);
+    REQUIRE_THROWS_AS(F(3, 1), std::out_of_range);
+    REQUIRE(F.toMatrix()(2, 3) == -0.25);
+
+    Vector v(3);
+    v[0] = 1.0 / 3.0;
+    BasicVector<long double> l(v);
+    REQUIRE(l[0] == static_cast<long double>(1.0 / 3.0));
+    FloatVector f(v);
+    REQUIRE(f.toVector()[0] == Approx(1.0 / 3.0).epsilon(1e-7));
+    REQUIRE_THROWS_AS(f[3], std::out_of_range);
+}
+
+TEST_CASE("BasicLUFactorization solves in every precision", "[BasicLU]") {
+    std::mt19937 rng(3);
+    const std::size_t n = 150;   // more than two panels
+    Matrix A = wellConditioned(n, rng);
+    Vector x = testdata::randomVector(n, rng);
+    Vector b = A * x;
+
+    Vector xf = BasicLUFactorization<float>(FloatMatrix(A)).solve(FloatVector(b)).toVector();
+    Vector xd = BasicLUFactorization<double>(BasicMatrix<double>(A))
+                    .solve(BasicVector<double>(b)).toVector();
+    Vector xl = BasicLUFactorization<long double>(BasicMatrix<long double>(A))
+                    .solve(BasicVector<long double>(b)).toVector();
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(xf[i] == Approx(x[i]).margin(1e-4));
+        REQUIRE(xd[i] == Approx(x[i]).margin(1e-12));
+        REQUIRE(xl[i] == Approx(x[i]).margin(1e-12));
+    }
+
+    Matrix S(2, 2);
+    S(1, 1) = 1; S(1, 2) = 2; S(2, 1) = 2; S(2, 2) = 4;
+    REQUIRE_THROWS_AS(BasicLUFactorization<float>(FloatMatrix(S)), std::runtime_error);
+    REQUIRE_THROWS_AS(BasicLUFactorization<float>(FloatMatrix(2, 3)), std::invalid_argument);
+
+    // The singularity test follows the precision: a pivot of one float ulp
+    // is noise in float but a perfectly good pivot in double.
+    FloatMatrix N(2, 2);
+    N(1, 1) = N(1, 2) = N(2, 1) = 1.0f;
+    N(2, 2) = 1.0f + std::numeric_limits<float>::epsilon();
+    REQUIRE_THROWS_AS(BasicLUFactorization<float>(N), std::runtime_error);
+    BasicLUFactorization<double> nd(BasicMatrix<double>(N.toMatrix()));
+    REQUIRE(nd.determinant() == Approx(std::numeric_limits<float>::epsilon()));
+    Vector r(2);
+    r[1] = 1.0;
+    nd.solveInPlace(Span<double>(r.data(), r.size()));
+    REQUIRE(r[1] == Approx(1.0 / std::numeric_limits<float>::epsilon()));
+}
+
+TEST_CASE("Mixed-precision refinement reaches double accuracy", "[MixedPrecision]") {
+    std::mt19937 rng(5);
+    const std::size_t n = 200;
+    Matrix A = wellConditioned(n, rng);
+    Vector x = testdata::randomVector(n, rng);
+    Vector b = A * x;
+
+    MixedPrecisionSystem sys(A, b);
+    Vector y(n);
+    const RefinementResult r = sys.Solve(y);
+    REQUIRE(r.converged);
+    REQUIRE_FALSE(r.fellBack);
+    REQUIRE(r.iterations >= 1);
+    REQUIRE(r.iterations <= 5);
+
+    // As accurate as the all-double LU, far beyond float precision.
+    Vector z = LUFactorization(A).solve(b);
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(y[i] == Approx(x[i]).margin(1e-12));
+        REQUIRE(y[i] == Approx(z[i]).margin(1e-12));
+    }
+    REQUIRE(sys.Solve()[0] == y[0]);
+}
+
+TEST_CASE("Mixed-precision falls back to double LU when float is not enough", "[MixedPrecision]") {
+    SECTION("entries outside the float range") {
+        Matrix A(2, 2);
+        A(1, 1) = 1e300; A(2, 2) = 1.0;
+        Vector b(2);
+        b[0] = 2e300; b[1] = 3.0;
+        Vector x(2);
+        const RefinementResult r = MixedPrecisionSystem(A, b).Solve(x);
+        REQUIRE(r.fellBack);
+        REQUIRE(x[0] == Approx(2.0));
+        REQUIRE(x[1] == Approx(3.0));
+    }
+    SECTION("singular in float but not in double") {
+        Matrix A(2, 2);
+        A(1, 1) = 1.0; A(1, 2) = 1.0;
+        A(2, 1) = 1.0; A(2, 2) = 1.0 + 1e-9;   // rounds to 1.0f
+        Vector b(2);
+        b[0] = 2.0; b[1] = 2.0 + 1e-9;
+        Vector x(2);
+        const RefinementResult r = MixedPrecisionSystem(A, b).Solve(x);
+        REQUIRE(r.fellBack);
+        REQUIRE_FALSE(r.converged);
+        REQUIRE(x[0] == Approx(1.0).margin(1e-6));
+        REQUIRE(x[1] == Approx(1.0).margin(1e-6));
+    }
+    SECTION("iteration budget exhausted") {
+        std::mt19937 rng(9);
+        Matrix A = wellConditioned(40, rng);
+        Vector b = testdata::randomVector(40, rng);
+        RefinementOptions opts;
+        opts.maxIterations = 0;
+        MixedPrecisionSystem sys(A, b, opts);
+        Vector x(40);
+        const RefinementResult r = sys.Solve(x);
+        REQUIRE(r.fellBack);
+        REQUIRE(r.iterations == 0);
+        REQUIRE(r.residualNorm < 1e-10);
+    }
+}
+
+TEST_CASE("Mixed-precision system validates its input", "[MixedPrecision]") {
+    REQUIRE_THROWS_AS(MixedPrecisionSystem(Matrix(2, 3), Vector(2)), std::invalid_argument);
+    REQUIRE_THROWS_AS(MixedPrecisionSystem(Matrix(2, 2), Vector(3)), std::invalid_argument);
+}
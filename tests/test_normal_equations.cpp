@@ -0,0 +1,97 @@
+// tests/test_normal_equations.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "LinearSystem.hpp"
+#include "NormalEquations.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// y = X·[1, -2, 0.5, 3] + noise, last column is the intercept.
+const std::vector<double> kBeta = { 1.0, -2.0, 0.5, 3.0 };
+
+} // namespace
+
+TEST_CASE("Chunked accumulation matches the full-matrix fit", "[NormalEquations]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(1000, kBeta, 0.1, 3, X, y);
+
+    NormalEquationAccumulator acc(4);
+    const std::size_t chunk = 128;   // last chunk is partial
+    for (std::size_t r = 0; r < X.rows(); r += chunk) {
+        const std::size_t m = std::min(chunk, X.rows() - r);
+        acc.add(m, X.row(r), X.stride(), y.data() + r);
+    }
+    REQUIRE(acc.count() == 1000);
+
+    Vector expected = LeastSquaresSystem(X, y).Solve();
+    Vector beta = acc.solve();
+    for (std::size_t j = 0; j < 4; ++j)
+        REQUIRE(beta[j] == Approx(expected[j]).epsilon(1e-9));
+
+    Vector r = X * beta;
+    r -= y;
+    REQUIRE(acc.residualSumOfSquares(beta) == Approx(r.dot(r)).epsilon(1e-8));
+}
+
+TEST_CASE("Accumulators merge, add single rows and reset", "[NormalEquations]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(200, kBeta, 0.1, 4, X, y);
+
+    NormalEquationAccumulator whole(4), left(4), right(4);
+    whole.add(X, y);
+    for (std::size_t i = 0; i < 200; ++i)
+        (i < 80 ? left : right).addRow(X.row(i), y[i]);
+    left.merge(right);
+    REQUIRE(left.count() == 200);
+    REQUIRE(left.sumSquares() == Approx(whole.sumSquares()));
+    for (std::size_t i = 0; i < 4; ++i) {
+        REQUIRE(left.rhs()[i] == Approx(whole.rhs()[i]));
+        for (std::size_t j = 0; j < 4; ++j)
+            REQUIRE(left.gram().row(i)[j] == Approx(whole.gram().row(i)[j]));
+    }
+
+    left.reset();
+    REQUIRE(left.count() == 0);
+    REQUIRE(left.sumSquares() == 0.0);
+    REQUIRE_THROWS_AS(left.merge(NormalEquationAccumulator(3)), std::length_error);
+    REQUIRE_THROWS_AS(left.add(Matrix(2, 3), Vector(2)), std::length_error);
+}
+
+TEST_CASE("Subtracting a shard undoes its merge", "[NormalEquations]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(120, kBeta, 0.1, 6, X, y);
+
+    NormalEquationAccumulator total(4), head(4), tail(4);
+    total.add(X, y);
+    head.add(40, X.data(), X.stride(), y.data());
+    tail.add(80, X.row(40), X.stride(), y.data() + 40);
+    total.subtract(head);
+    REQUIRE(total.count() == 80);
+    REQUIRE(total.sumSquares() == Approx(tail.sumSquares()));
+    for (std::size_t i = 0; i < 4; ++i) {
+        REQUIRE(total.rhs()[i] == Approx(tail.rhs()[i]));
+        for (std::size_t j = 0; j < 4; ++j)
+            REQUIRE(total.gram().row(i)[j] == Approx(tail.gram().row(i)[j]).margin(1e-9));
+    }
+    REQUIRE_THROWS_AS(tail.subtract(NormalEquationAccumulator(3)), std::length_error);
+    head.add(X, y);
+    REQUIRE_THROWS_AS(tail.subtract(head), std::invalid_argument);
+}
+
+TEST_CASE("Ridge term shrinks the coefficients", "[NormalEquations]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(50, kBeta, 0.1, 5, X, y);
+    NormalEquationAccumulator acc(4);
+    acc.add(X, y);
+    Vector plain = acc.solve();
+    Vector ridge = acc.solve(1e3);
+    REQUIRE(ridge.dot(ridge) < plain.dot(plain));
+    REQUIRE_THROWS_AS(NormalEquationAccumulator(4).solve(), std::runtime_error);
+}
@@ -0,0 +1,115 @@
+// tests/test_online_regression.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "LinearSystem.hpp"
+#include "OnlineRegression.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// Rows of [x1, x2, x3, 1] and y = 2·x1 - x2 + 0.5·x3 + 4 + noise.
+const std::vector<double> kBeta = { 2.0, -1.0, 0.5, 4.0 };
+
+// Batch least squares on rows [first, last).
+Vector batchFit(const Matrix& X, const Vector& y, std::size_t first, std::size_t last) {
+    Matrix Xs(last - first, X.cols());
+    Vector ys(last - first);
+    for (std::size_t i = first; i < last; ++i) {
+        std::copy(X.row(i), X.row(i) + X.cols(), Xs.row(i - first));
+        ys[i - first] = y[i];
+    }
+    return LeastSquaresSystem(Xs, ys).Solve();
+}
+
+} // namespace
+
+TEST_CASE("OnlineRegression tracks the batch fit row by row", "[Online]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(300, kBeta, 0.1, 1, X, y);
+
+    OnlineRegression model(4);
+    REQUIRE_THROWS_AS(model.coefficients(), std::runtime_error);
+    for (std::size_t i = 0; i < 300; ++i) {
+        model.add(X.row(i), y[i]);
+        if (i + 1 == 10 || i + 1 == 300) {
+            Vector expected = batchFit(X, y, 0, i + 1);
+            const Vector& beta = model.coefficients();
+            for (std::size_t j = 0; j < 4; ++j)
+                REQUIRE(beta[j] == Approx(expected[j]).epsilon(1e-9));
+        }
+    }
+    REQUIRE(model.count() == 300);
+}
+
+TEST_CASE("OnlineRegression downdates a sliding window", "[Online]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(120, kBeta, 0.1, 2, X, y);
+    const std::size_t window = 50;
+
+    OnlineRegression model(4);
+    for (std::size_t i = 0; i < 120; ++i) {
+        model.add(X.row(i), y[i]);
+        if (i >= window)
+            model.remove(X.row(i - window), y[i - window]);
+    }
+    REQUIRE(model.count() == window);
+    Vector expected = batchFit(X, y, 120 - window, 120);
+    for (std::size_t j = 0; j < 4; ++j)
+        REQUIRE(model.coefficients()[j] == Approx(expected[j]).epsilon(1e-8));
+}
+
+TEST_CASE("OnlineRegression rejects downdates that break definiteness", "[Online]") {
+    OnlineRegression model(2);
+    const double a[2] = { 1.0, 0.0 }, b[2] = { 0.0, 1.0 };
+    model.add(a, 1.0);
+    model.add(b, 2.0);
+    Matrix before = model.factor();
+    const double big[2] = { 2.0, 0.0 };
+    REQUIRE_THROWS_AS(model.remove(big, 0.0), std::runtime_error);
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 2; ++j)
+            REQUIRE(model.factor().row(i)[j] == before.row(i)[j]);
+    REQUIRE(model.coefficients()[1] == Approx(2.0));
+}
+
+TEST_CASE("Forgetting factor weights recent rows more", "[Online]") {
+    // The relationship changes half-way; a forgetting model follows it.
+    std::mt19937 rng(3);
+    std::normal_distribution<double> dist(0.0, 1.0);
+    OnlineRegression forgetful(2, 0.0, 0.9), plain(2);
+    for (std::size_t i = 0; i < 400; ++i) {
+        const double x[2] = { dist(rng), 1.0 };
+        const double slope = i < 200 ? 1.0 : 5.0;
+        forgetful.add(x, slope * x[0]);
+        plain.add(x, slope * x[0]);
+    }
+    REQUIRE(forgetful.coefficients()[0] == Approx(5.0).epsilon(1e-6));
+    REQUIRE(std::abs(plain.coefficients()[0] - 5.0) > 1.0);
+}
+
+TEST_CASE("Mini-batches, ridge prior and argument checks", "[Online]") {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(40, kBeta, 0.1, 4, X, y);
+    OnlineRegression batched(4), single(4);
+    batched.add(X, y);
+    for (std::size_t i = 0; i < 40; ++i) single.add(X.row(i), y[i]);
+    for (std::size_t j = 0; j < 4; ++j)
+        REQUIRE(batched.coefficients()[j] == Approx(single.coefficients()[j]));
+
+    OnlineRegression ridge(4, 1.0);
+    Vector x(4);
+    x[0] = 1.0;
+    ridge.add(x, 2.0);               // solvable after one row thanks to λ
+    REQUIRE(ridge.coefficients()[0] == Approx(1.0));
+
+    REQUIRE_THROWS_AS(OnlineRegression(3, -1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(OnlineRegression(3, 0.0, 0.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(single.add(Vector(3), 1.0), std::length_error);
+}
@@ -0,0 +1,136 @@
+// tests/test_regularization_path.cpp
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <stdexcept>
+#include "RegularizationPath.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// y = X·[3, 0, -2, 0, 0.5, 5] + noise; the last column is the intercept.
+NormalEquationAccumulator syntheticNormal(std::size_t m, unsigned seed) {
+    Matrix X(1, 1);
+    Vector y(1);
+    testdata::syntheticData(m, { 3.0, 0.0, -2.0, 0.0, 0.5, 5.0 }, 0.5, seed, X, y);
+    NormalEquationAccumulator acc(6);
+    acc.add(X, y);
+    return acc;
+}
+
+} // namespace
+
+TEST_CASE("Ridge path matches independent solves", "[RegularizationPath]") {
+    NormalEquationAccumulator normal = syntheticNormal(300, 1);
+    RidgePath ridge(normal);
+    REQUIRE(ridge.features() == 6);
+
+    const std::vector<double> lambdas = { 0.0, 0.1, 1.0, 10.0, 100.0, 1e4 };
+    Matrix betas = ridge.path(lambdas);
+    for (std::size_t l = 0; l < lambdas.size(); ++l) {
+        Vector direct = normal.solve(lambdas[l]);
+        Vector single = ridge.solve(lambdas[l]);
+        for (std::size_t j = 0; j < 6; ++j) {
+            REQUIRE(betas.row(l)[j] == Approx(direct[j]).margin(1e-10));
+            REQUIRE(single[j] == betas.row(l)[j]);
+        }
+    }
+    REQUIRE(ridge.degreesOfFreedom(0.0) == Approx(6.0));
+    REQUIRE(ridge.degreesOfFreedom(10.0) < ridge.degreesOfFreedom(1.0));
+    REQUIRE_THROWS_AS(ridge.solve(-1.0), std::invalid_argument);
+}
+
+TEST_CASE("Ridge path needs a positive lambda for singular XᵀX", "[RegularizationPath]") {
+    // Third column duplicates the first.
+    Matrix G(3, 3);
+    Vector g(3);
+    const double rows[4][3] = { { 1, 2, 1 }, { 2, 0, 2 }, { 0, 1, 0 }, { 1, 1, 1 } };
+    for (const auto& r : rows) {
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                G.row(i)[j] += r[i] * r[j];
+        for (std::size_t i = 0; i < 3; ++i) g[i] += r[i];
+    }
+    RidgePath ridge(G, g);
+    REQUIRE_THROWS_AS(ridge.solve(0.0), std::runtime_error);
+    Vector beta = ridge.solve(0.5);
+    REQUIRE(beta[0] == Approx(beta[2]));   // the penalty splits tied columns evenly
+    REQUIRE_THROWS_AS(RidgePath(Matrix(2, 3), Vector(2)), std::invalid_argument);
+    REQUIRE_THROWS_AS(RidgePath(G, Vector(2)), std::length_error);
+}
+
+TEST_CASE("Elastic net with alpha = 0 is ridge", "[RegularizationPath]") {
+    NormalEquationAccumulator normal = syntheticNormal(200, 2);
+    ElasticNetOptions options;
+    options.alpha = 0.0;
+    ElasticNetPath net(normal, options);
+    RidgePath ridge(normal);
+    for (double lambda : { 0.5, 5.0, 50.0 }) {
+        ElasticNetFit fit = net.fit(lambda);
+        REQUIRE(fit.converged);
+        Vector expected = ridge.solve(lambda);
+        for (std::size_t j = 0; j < 6; ++j)
+            REQUIRE(fit.coefficients[j] == Approx(expected[j]).margin(1e-6));
+    }
+}
+
+TEST_CASE("Lasso path satisfies the optimality conditions", "[RegularizationPath]") {
+    NormalEquationAccumulator normal = syntheticNormal(400, 3);
+    ElasticNetOptions options;
+    options.penaltyFactors = { 1, 1, 1, 1, 1, 0 };   // intercept unpenalized
+    ElasticNetPath net(normal, options);
+
+    const double lmax = net.lambdaMax();
+    ElasticNetFit top = net.fit(lmax);
+    for (std::size_t j = 0; j < 5; ++j)
+        REQUIRE(top.coefficients[j] == Approx(0.0).margin(1e-6));
+    REQUIRE(top.coefficients[5] == Approx(normal.rhs()[5] / normal.count()));
+
+    std::vector<double> grid = net.lambdaGrid(20, 1e-3);
+    REQUIRE(grid.front() == lmax);
+    REQUIRE(grid.back() == Approx(1e-3 * lmax));
+    std::vector<ElasticNetFit> fits = net.path(grid);
+    std::size_t warmSweeps = 0, coldSweeps = 0;
+    for (const ElasticNetFit& fit : fits) {
+        REQUIRE(fit.converged);
+        warmSweeps += fit.sweeps;
+        coldSweeps += net.fit(fit.lambda).sweeps;
+
+        // KKT: |Xᵀ(y - Xβ)|_j = λ where β_j != 0, <= λ where β_j == 0.
+        Vector c = normal.rhs() - normal.gram() * fit.coefficients;
+        for (std::size_t j = 0; j < 5; ++j) {
+            if (fit.coefficients[j] != 0.0)
+                REQUIRE(std::abs(c[j]) == Approx(fit.lambda).epsilon(1e-3));
+            else
+                REQUIRE(std::abs(c[j]) <= fit.lambda * (1.0 + 1e-3));
+        }
+        REQUIRE(std::abs(c[5]) < 1e-3);
+    }
+    REQUIRE(warmSweeps <= coldSweeps);
+
+    // The true zeros stay out longest: at a moderate λ only 0, 2 and 4 are active.
+    const ElasticNetFit mid = net.fit(0.05 * lmax);
+    REQUIRE(mid.coefficients[1] == 0.0);
+    REQUIRE(mid.coefficients[3] == 0.0);
+    REQUIRE(mid.coefficients[0] > 0.0);
+    REQUIRE(mid.coefficients[2] < 0.0);
+}
+
+TEST_CASE("Elastic net rejects bad settings", "[RegularizationPath]") {
+    NormalEquationAccumulator normal = syntheticNormal(50, 4);
+    ElasticNetOptions options;
+    options.alpha = 1.5;
+    REQUIRE_THROWS_AS(ElasticNetPath(normal, options), std::invalid_argument);
+    options.alpha = 0.5;
+    options.penaltyFactors = { 1, 1 };
+    REQUIRE_THROWS_AS(ElasticNetPath(normal, options), std::length_error);
+    options.penaltyFactors = { 1, 1, 1, 1, 1, -1 };
+    REQUIRE_THROWS_AS(ElasticNetPath(normal, options), std::invalid_argument);
+
+    ElasticNetPath net(normal);
+    REQUIRE_THROWS_AS(net.fit(-1.0), std::invalid_argument);
+    REQUIRE_THROWS_AS(net.fit(1.0, Vector(3)), std::length_error);
+    REQUIRE_THROWS_AS(net.lambdaGrid(5, 0.0), std::invalid_argument);
+    options.alpha = 0.0;
+    options.penaltyFactors.clear();
+    REQUIRE_THROWS_AS(ElasticNetPath(normal, options).lambdaGrid(5), std::invalid_argument);
+}
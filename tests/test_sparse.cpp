@@ -0,0 +1,165 @@
+// tests/test_sparse.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include "ConjugateGradient.hpp"
+#include "LinearSystem.hpp"
+#include "SparseMatrix.hpp"
+#include "TestData.hpp"
+
+namespace {
+
+// rows×cols matrix with about @p density of its entries set.
+std::vector<Triplet> randomTriplets(std::size_t rows, std::size_t cols,
+                                    double density, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::vector<Triplet> t;
+    for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+            if (coin(rng) < density)
+                t.push_back({ i, j, dist(rng) });
+    std::shuffle(t.begin(), t.end(), rng);
+    return t;
+}
+
+} // namespace
+
+TEST_CASE("SparseMatrix builds CSR and CSC from unordered triplets", "[Sparse]") {
+    std::vector<Triplet> t = { {2, 1, 4.0}, {0, 0, 1.0}, {0, 2, 2.0},
+                               {2, 1, 1.0}, {1, 1, 3.0} };   // (2,1) duplicated
+    for (auto format : { SparseMatrix::Format::CSR, SparseMatrix::Format::CSC }) {
+        SparseMatrix A(3, 3, t, format);
+        REQUIRE(A.format() == format);
+        REQUIRE(A.nonZeros() == 4);
+        REQUIRE(A.coeff(2, 1) == 5.0);
+        REQUIRE(A.coeff(0, 2) == 2.0);
+        REQUIRE(A.coeff(1, 0) == 0.0);
+        Matrix D = A.toDense();
+        REQUIRE(D(1, 1) == 1.0);
+        REQUIRE(D(3, 2) == 5.0);
+    }
+    REQUIRE(SparseMatrix(3, 3, t).outerIndex() == std::vector<std::size_t>{ 0, 2, 3, 4 });
+    REQUIRE_THROWS_AS(SparseMatrix(2, 2, t), std::out_of_range);
+}
+
+TEST_CASE("SparseMatrix format conversion round-trips", "[Sparse]") {
+    SparseMatrix A(40, 30, randomTriplets(40, 30, 0.1, 1));
+    SparseMatrix C = A.toCSC();
+    REQUIRE(C.format() == SparseMatrix::Format::CSC);
+    REQUIRE(C.nonZeros() == A.nonZeros());
+    SparseMatrix back = C.toCSR();
+    REQUIRE(back.outerIndex() == A.outerIndex());
+    REQUIRE(back.innerIndex() == A.innerIndex());
+    REQUIRE(back.values() == A.values());
+
+    SparseMatrix fromDense(A.toDense(), SparseMatrix::Format::CSC);
+    REQUIRE(fromDense.innerIndex() == C.innerIndex());
+    REQUIRE(fromDense.values() == C.values());
+}
+
+TEST_CASE("Sparse products match the dense ones in both layouts", "[Sparse]") {
+    // Large enough for several parallel blocks in both directions.
+    const std::size_t m = 20000, n = 50;
+    SparseMatrix csr(m, n, randomTriplets(m, n, 0.1, 2));
+    SparseMatrix csc = csr.toCSC();
+    Matrix dense = csr.toDense();
+    Vector x = testdata::randomVector(n, 3);
+    Vector r = testdata::randomVector(m, 4);
+
+    Vector expectedAx = dense * x;
+    Vector expectedAtr(n);
+    dense.transposeMultiply(r, expectedAtr);
+
+    for (const SparseMatrix* A : { &csr, &csc }) {
+        Vector y = *A * x;
+        for (std::size_t i = 0; i < m; ++i)
+            REQUIRE(y[i] == Approx(expectedAx[i]).margin(1e-12));
+        Vector z(n);
+        A->transposeMultiply(r, z);
+        for (std::size_t j = 0; j < n; ++j)
+            REQUIRE(z[j] == Approx(expectedAtr[j]).margin(1e-12));
+    }
+    Vector wrong(n + 1);
+    REQUIRE_THROWS_AS(csr.multiply(x, wrong), std::length_error);
+}
+
+TEST_CASE("Sparse scatter products reuse a caller-owned scratch buffer", "[Sparse]") {
+    // CSR transpose and CSC multiply take the parallel scatter path.
+    const std::size_t m = 20000, n = 50;
+    SparseMatrix csr(m, n, randomTriplets(m, n, 0.1, 5));
+    SparseMatrix csc = csr.toCSC();
+    Vector x = testdata::randomVector(n, 6);
+    Vector r = testdata::randomVector(m, 7);
+    Vector expectedAtr(n), expectedAx(m);
+    csr.transposeMultiply(r, expectedAtr);
+    csc.multiply(x, expectedAx);
+
+    std::vector<double> scratch;
+    Vector z(n), y(m);
+    csr.transposeMultiply(r, z, scratch);
+    csc.multiply(x, y, scratch);       // grows to the larger of the two
+    REQUIRE_FALSE(scratch.empty());
+    const double* buffer = scratch.data();
+    for (int pass = 0; pass < 3; ++pass) {
+        csr.transposeMultiply(r, z, scratch);
+        csc.multiply(x, y, scratch);
+        REQUIRE(scratch.data() == buffer);
+        for (std::size_t j = 0; j < n; ++j) REQUIRE(z[j] == expectedAtr[j]);
+        for (std::size_t i = 0; i < m; ++i) REQUIRE(y[i] == expectedAx[i]);
+    }
+
+    SparseOperator op(csr);
+    op.applyTranspose(r, z);
+    op.applyTranspose(r, z);
+    for (std::size_t j = 0; j < n; ++j) REQUIRE(z[j] == expectedAtr[j]);
+}
+
+TEST_CASE("CG solves sparse systems through SparseOperator", "[Sparse]") {
+    // 1-D Laplacian with a varying diagonal.
+    const std::size_t n = 500;
+    std::vector<Triplet> t;
+    for (std::size_t i = 0; i < n; ++i) {
+        t.push_back({ i, i, 2.0 + double(i % 7) });
+        if (i > 0)     t.push_back({ i, i - 1, -1.0 });
+        if (i + 1 < n) t.push_back({ i, i + 1, -1.0 });
+    }
+    SparseMatrix A(n, n, t);
+    SparseOperator op(A);
+    Vector b = testdata::randomVector(n, 5);
+
+    JacobiPreconditioner jacobi(A.diagonal());
+    CGOptions opts;
+    opts.relTol = 1e-12;
+    PosSymLinSystem sys(op, b, opts, &jacobi);
+    Vector x(n);
+    CGResult res = sys.Solve(x);
+    REQUIRE(res.converged);
+
+    Vector Ax = A * x;
+    Ax -= b;
+    REQUIRE(std::sqrt(Ax.dot(Ax)) < 1e-9);
+}
+
+TEST_CASE("Sparse least squares via NormalOperator", "[Sparse]") {
+    const std::size_t m = 400, n = 20;
+    std::vector<Triplet> t = randomTriplets(m, n, 0.2, 6);
+    for (std::size_t j = 0; j < n; ++j)
+        t.push_back({ j, j, 1.0 });   // keep full column rank
+    SparseMatrix X(m, n, t);
+    Vector y = testdata::randomVector(m, 7);
+
+    SparseOperator Xop(X);
+    NormalOperator normal(Xop);
+    CGOptions opts;
+    opts.relTol = 1e-12;
+    Vector beta = PosSymLinSystem(normal, normal.rhs(y), opts).Solve();
+
+    Matrix Xd = X.toDense();
+    Vector expected = LeastSquaresSystem(Xd, y).Solve();
+    for (std::size_t j = 0; j < n; ++j)
+        REQUIRE(beta[j] == Approx(expected[j]).epsilon(1e-8));
+}
@@ -35,4 +35,31 @@ TEST_CASE("LinearSystem throws on dimension mismatch", "[LinearSystem]") {
     Matrix A(2,2);
     Vector b(3);
     REQUIRE_THROWS_AS( LinearSystem(A,b), std::invalid_argument );
-}
\ No newline at end of file
+}
+
+TEST_CASE("Cholesky system solves symmetric system", "[CholeskySystem]") {
+    Matrix A(2,2);
+    Vector b(2);
+    A(1,1)=3; A(1,2)=1; A(2,1)=1; A(2,2)=2;
+    b[0]=5; b[1]=5;
+    CholeskySystem chol(A,b);
+    auto x = chol.Solve();
+    REQUIRE( x[0] == Approx(1.0) );
+    REQUIRE( x[1] == Approx(2.0) );
+}
+
+TEST_CASE("Least-squares system fits an overdetermined line", "[LeastSquaresSystem]") {
+    // Points (1,1), (2,2), (3,2): best fit y = 0.5 x + 2/3
+    Matrix X(3,2);
+    Vector y(3);
+    X(1,1)=1; X(2,1)=2; X(3,1)=3;
+    X(1,2)=X(2,2)=X(3,2)=1;
+    y[0]=1; y[1]=2; y[2]=2;
+    LeastSquaresSystem ls(X,y);
+    auto beta = ls.Solve();
+    REQUIRE( beta.size() == 2 );
+    REQUIRE( beta[0] == Approx(0.5) );
+    REQUIRE( beta[1] == Approx(2.0/3.0) );
+    REQUIRE_THROWS_AS( LeastSquaresSystem(Matrix(1,2), Vector(1)), std::invalid_argument );
+    REQUIRE_THROWS_AS( LeastSquaresSystem(X, Vector(2)), std::invalid_argument );
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+// tests/test_threadpool.cpp
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "Blas.hpp"
+#include "ThreadPool.hpp"
+
+TEST_CASE("ThreadPool covers every index exactly once", "[ThreadPool]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+    std::vector<int> hits(10007, 0);
+    pool.parallelFor(0, hits.size(), 97, [&](std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) ++hits[i];
+    });
+    REQUIRE(std::accumulate(hits.begin(), hits.end(), 0) == 10007);
+    REQUIRE(*std::min_element(hits.begin(), hits.end()) == 1);
+}
+
+TEST_CASE("ThreadPool chunks are grain-aligned", "[ThreadPool]") {
+    ThreadPool pool(3);
+    std::atomic<int> misaligned{0};
+    pool.parallelFor(5, 1005, 100, [&](std::size_t b, std::size_t e) {
+        if ((b - 5) % 100 != 0 || e - b > 100) ++misaligned;
+    });
+    REQUIRE(misaligned == 0);
+    REQUIRE(chunkCount(1000, 100) == 10);
+    REQUIRE(chunkCount(1001, 100) == 11);
+}
+
+TEST_CASE("ThreadPool supports nested parallelFor and propagates exceptions", "[ThreadPool]") {
+    ThreadPool pool(4);
+    std::atomic<long> total{0};
+    pool.parallelFor(0, 8, 1, [&](std::size_t, std::size_t) {
+        pool.parallelFor(0, 100, 10, [&](std::size_t b, std::size_t e) {
+            total += static_cast<long>(e - b);
+        });
+    });
+    REQUIRE(total == 800);
+
+    REQUIRE_THROWS_AS(pool.parallelFor(0, 100, 1, [](std::size_t b, std::size_t) {
+        if (b == 42) throw std::runtime_error("boom");
+    }), std::runtime_error);
+
+    pool.resize(1);
+    REQUIRE(pool.size() == 1);
+    long serial = 0;
+    pool.parallelFor(0, 50, 7, [&](std::size_t b, std::size_t e) { serial += long(e - b); });
+    REQUIRE(serial == 50);
+}
+
+TEST_CASE("Parallel gemm agrees with single-threaded gemm", "[ThreadPool]") {
+    const std::size_t n = 300;
+    Matrix A(n, n), B(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j) {
+            A.row(i)[j] = double((i * 7 + j * 3) % 11) - 5.0;
+            B.row(i)[j] = double((i * 5 + j) % 13) - 6.0;
+        }
+    const std::size_t saved = numThreads();
+    setNumThreads(1);
+    Matrix serial = A * B;
+    setNumThreads(4);
+    Matrix parallel = A * B;
+    setNumThreads(saved);
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+            REQUIRE(parallel.row(i)[j] == serial.row(i)[j]);
+}
+
+TEST_CASE("Parallel gram agrees with single-threaded gram", "[ThreadPool]") {
+    const std::size_t m = 40000, n = 7;
+    Matrix X(m, n);
+    Vector y(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < n; ++j)
+            X.row(i)[j] = std::sin(double(i * n + j));
+        y[i] = std::cos(double(i));
+    }
+    Matrix Gs(n, n), Gp(n, n);
+    Vector gs(n), gp(n);
+    const std::size_t saved = numThreads();
+    setNumThreads(1);
+    gram(X, y, Gs, gs);
+    setNumThreads(4);
+    gram(X, y, Gp, gp);
+    setNumThreads(saved);
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE(gp[i] == gs[i]);
+        for (std::size_t j = 0; j < n; ++j)
+            REQUIRE(Gp.row(i)[j] == Gs.row(i)[j]);
+    }
+}
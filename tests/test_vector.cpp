@@ -53,3 +53,44 @@ TEST_CASE("Vector out-of-range access throws", "[Vector]") {
     REQUIRE_THROWS_AS(v(0), std::out_of_range);   // 1-based OOB
     REQUIRE_THROWS_AS(v(3), std::out_of_range);   // 1-based OOB
 }
+
+TEST_CASE("Vector move and compound operators", "[Vector]") {
+    Vector a(3);
+    a[0] = 1; a[1] = 2; a[2] = 3;
+
+    Vector moved(std::move(a));
+    REQUIRE(moved.size() == 3);
+    REQUIRE(a.size() == 0);
+    REQUIRE(moved[2] == Approx(3.0));
+
+    Vector b(3);
+    b[0] = 1; b[1] = 1; b[2] = 1;
+    moved += b;
+    REQUIRE(moved[0] == Approx(2.0));
+    moved -= b;
+    moved *= 2.0;
+    REQUIRE(moved[1] == Approx(4.0));
+
+    moved.axpy(0.5, b);
+    REQUIRE(moved[2] == Approx(6.5));
+    moved.axpby(2.0, b, 0.0);
+    REQUIRE(moved[0] == Approx(2.0));
+    REQUIRE(moved.dot(b) == Approx(6.0));
+    REQUIRE_THROWS_AS(moved += Vector(2), std::length_error);
+
+    a = std::move(moved);
+    REQUIRE(a.size() == 3);
+    REQUIRE(a[1] == Approx(2.0));
+}
+
+TEST_CASE("Vector iterators and raw data", "[Vector]") {
+    Vector v(4);
+    double k = 1.0;
+    for (double& e : v) e = k++;
+    REQUIRE(v.end() - v.begin() == 4);
+    REQUIRE(v.data()[3] == Approx(4.0));
+    const Vector& cv = v;
+    double sum = 0.0;
+    for (double e : cv) sum += e;
+    REQUIRE(sum == Approx(10.0));
+}